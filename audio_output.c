@@ -0,0 +1,155 @@
+#include "audio_output.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+// Two DMA channels chained to each other play the two buffers back to back.
+// When one finishes, the other starts immediately and the completion IRQ
+// asks audio_output_task() to render the finished buffer again.
+static stereo_t audio_buffer[2][AUDIO_BLOCK_SIZE];
+static uint audio_dma_channel[2];
+static volatile bool audio_output_ready; // The channels above are claimed, set once by audio_output_init()
+
+// Blocks played without the replays after an underrun, shifted left by one, with the index of the
+// buffer the chain started last in bit 0. The IRQ writes it once per completed buffer, so
+// audio_output_frame() on the other core always reads a matching pair.
+static volatile uint32_t audio_position;
+static volatile bool audio_refill_pending[2];
+static audio_render_callback_t audio_render;
+
+audio_output_stats_t audio_output_stats;
+
+float audio_output_pio_clkdiv()
+{
+    // Let the DAC state machine run at exactly FS so the DMA is paced by its DREQ
+    return (float)clock_get_hz(clk_sys) / (FS * AUDIO_PIO_CYCLES_PER_FRAME);
+}
+
+static void audio_output_dma_irq_handler()
+{
+    for (int i = 0; i < 2; i++)
+    {
+        uint ch = audio_dma_channel[i];
+        if (!dma_channel_get_irq0_status(ch))
+        {
+            continue;
+        }
+        dma_channel_acknowledge_irq0(ch);
+
+        // Re-arm the finished channel so the next chain trigger starts from the top of its buffer
+        dma_channel_set_read_addr(ch, audio_buffer[i], false);
+        audio_output_stats.blocks_played++;
+
+        // The other buffer has just been started by the chain
+        if (audio_refill_pending[i ^ 1])
+        {
+            audio_output_stats.underruns++;
+        }
+        audio_refill_pending[i] = true;
+        audio_position = ((audio_output_stats.blocks_played - audio_output_stats.underruns) << 1) | (uint32_t)(i ^ 1);
+    }
+}
+
+void audio_output_init(PIO pio, uint sm, audio_render_callback_t render)
+{
+    audio_render = render;
+
+    for (int i = 0; i < 2; i++)
+    {
+        for (int n = 0; n < AUDIO_BLOCK_SIZE; n++)
+        {
+            audio_buffer[i][n].u32 = 0; // Start with silence
+        }
+        audio_dma_channel[i] = dma_claim_unused_channel(true);
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        dma_channel_config c = dma_channel_get_default_config(audio_dma_channel[i]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
+        channel_config_set_chain_to(&c, audio_dma_channel[i ^ 1]);
+        dma_channel_configure(audio_dma_channel[i], &c, &pio->txf[sm], audio_buffer[i], AUDIO_BLOCK_SIZE, false);
+        dma_channel_set_irq0_enabled(audio_dma_channel[i], true);
+    }
+
+    irq_set_exclusive_handler(DMA_IRQ_0, audio_output_dma_irq_handler);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    // Buffer 0 plays silence first while buffer 1 gets rendered
+    audio_refill_pending[0] = false;
+    audio_refill_pending[1] = true;
+    audio_position = 0;
+    dma_channel_start(audio_dma_channel[0]);
+
+    __mem_fence_release(); // Channel numbers before the flag, audio_output_frame() may run on the other core
+    audio_output_ready = true;
+}
+
+void audio_output_task()
+{
+    for (int i = 0; i < 2; i++)
+    {
+        // Never render into the buffer the DMA is currently reading
+        if (!audio_refill_pending[i] || dma_channel_is_busy(audio_dma_channel[i]))
+        {
+            continue;
+        }
+
+        audio_render(audio_buffer[i], AUDIO_BLOCK_SIZE);
+        audio_refill_pending[i] = false;
+
+        // Count refills that only just made it before the playing buffer ran out
+        uint playing = audio_dma_channel[i ^ 1];
+        uint32_t frames_left = dma_hw->ch[playing].transfer_count & 0x0fffffff; // Low bits hold the count on RP2350
+        if (dma_channel_is_busy(playing) && frames_left < AUDIO_LATE_REFILL_MARGIN)
+        {
+            audio_output_stats.late_refills++;
+        }
+    }
+}
+
+// Frame the DAC is playing right now, counted like the frames passed to the render callback:
+// the silent start buffer and buffers replayed after an underrun are left out. Wraps around
+// with the 32-bit counter. 0 until audio_output_init() has claimed the DMA channels, as MIDI
+// input may already be running then.
+uint32_t audio_output_frame()
+{
+    if (!audio_output_ready)
+    {
+        return 0;
+    }
+    __mem_fence_acquire();
+
+    uint32_t position;
+    uint32_t frames;
+    int playing;
+    do
+    {
+        // Read again if a buffer completed in between, or while the chain was switching buffers
+        position = audio_position;
+        playing = -1;
+        uint32_t frames_left = 0;
+        for (int i = 0; i < 2; i++)
+        {
+            if (dma_channel_is_busy(audio_dma_channel[i]))
+            {
+                playing = i;
+                frames_left = dma_hw->ch[audio_dma_channel[i]].transfer_count & 0x0fffffff; // Low bits hold the count on RP2350
+            }
+        }
+
+        // The chain starts the next buffer before the IRQ counts the finished one. Count it here unless
+        // it is a replay, which the IRQ will count as an underrun.
+        uint32_t blocks = position >> 1;
+        if (playing >= 0 && (uint32_t)playing != (position & 1) && !audio_refill_pending[playing])
+        {
+            blocks++;
+        }
+        frames = blocks * AUDIO_BLOCK_SIZE - frames_left;
+    } while (playing < 0 || position != audio_position);
+    return frames;
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#ifndef AUDIO_OUTPUT_H
+#define AUDIO_OUTPUT_H
+
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "synthesizer.h"
+
+#define AUDIO_PIO_CYCLES_PER_FRAME 64                  // PIO cycles the LSBJ16bit program spends per stereo frame
+#define AUDIO_LATE_REFILL_MARGIN (AUDIO_BLOCK_SIZE / 4) // Refills finishing with fewer frames left than this are counted as late
+
+typedef void (*audio_render_callback_t)(stereo_t *buffer, size_t frames);
+
+typedef struct
+{
+    volatile uint32_t blocks_played; // Buffers completed by the DMA
+    volatile uint32_t underruns;     // Buffers that started playing before they were refilled
+    volatile uint32_t late_refills;  // Refills that finished within AUDIO_LATE_REFILL_MARGIN of their deadline
+} audio_output_stats_t;
+
+extern audio_output_stats_t audio_output_stats;
+
+float audio_output_pio_clkdiv();
+void audio_output_init(PIO pio, uint sm, audio_render_callback_t render);
+void audio_output_task();
+uint32_t audio_output_frame();
+
+#endif // AUDIO_OUTPUT_H
@@ -0,0 +1,142 @@
+#include "drum.h"
+#include "voice_alloc.h"
+
+drum_voice_t drum_voice[DRUM_VOICE_NUM];
+
+// Choke groups of the GM percussion notes, a new hit stops the sounding notes of its group
+static uint8_t drum_choke_group(uint8_t note)
+{
+    switch (note)
+    {
+    case 42: // Closed hi-hat
+    case 44: // Pedal hi-hat
+    case 46: // Open hi-hat
+        return 1;
+    case 71: // Short whistle
+    case 72: // Long whistle
+        return 2;
+    case 73: // Short guiro
+    case 74: // Long guiro
+        return 3;
+    case 78: // Mute cuica
+    case 79: // Open cuica
+        return 4;
+    case 80: // Mute triangle
+    case 81: // Open triangle
+        return 5;
+    default:
+        return 0;
+    }
+}
+
+// Channel volume, expression, pan and output gain with the hit's velocity
+static void drum_update_gain(drum_voice_t *dv)
+{
+    stereo_t pair = stereo_gain(DRUM_CHANNEL, dv->velocity, channel_state[DRUM_CHANNEL].tone.output_gain, 0);
+    dv->gain_left = pair.ch.left;
+    dv->gain_right = pair.ch.right;
+}
+
+void drum_init()
+{
+    for (int i = 0; i < DRUM_VOICE_NUM; i++)
+    {
+        drum_voice[i].data = NULL;
+    }
+}
+
+void drum_note_on(uint8_t note, uint8_t velocity)
+{
+    if (velocity == 0 || note < PCM_START_NOTE || note > PCM_END_NOTE)
+    {
+        return;
+    }
+    const pcm_sample_t *sample = &pcm_samples[note - PCM_START_NOTE];
+    if (sample->data == NULL)
+    {
+        return;
+    }
+
+    // Free the voices of the choke group, then take a free voice or the one closest to its end
+    uint8_t group = drum_choke_group(note);
+    drum_voice_t *dv = NULL;
+    uint32_t least_left = UINT32_MAX;
+    for (int i = 0; i < DRUM_VOICE_NUM; i++)
+    {
+        drum_voice_t *v = &drum_voice[i];
+        if (v->data != NULL && group != 0 && v->choke_group == group)
+        {
+            v->data = NULL;
+        }
+        uint32_t left = (v->data != NULL) ? v->length - v->position : 0;
+        if (left < least_left)
+        {
+            least_left = left;
+            dv = v;
+        }
+    }
+    if (least_left != 0)
+    {
+        voice_alloc_stats[DRUM_CHANNEL].voices_stolen++;
+    }
+
+    dv->data = sample->data;
+    dv->length = sample->length;
+    dv->position = 0;
+    dv->delay = PCM_INITIAL_SILENCE_SAMPLES; // To make sure PCM playback starts after a delay
+    dv->note = note;
+    dv->velocity = velocity;
+    dv->choke_group = group;
+    drum_update_gain(dv);
+}
+
+// Recompute the gains of the sounding drums after a mixer change on the drum channel
+void drum_update_gains()
+{
+    for (int i = 0; i < DRUM_VOICE_NUM; i++)
+    {
+        if (drum_voice[i].data != NULL)
+        {
+            drum_update_gain(&drum_voice[i]);
+        }
+    }
+}
+
+// Mix the sounding drums into out
+void drum_render(stereo_t *out, size_t frames)
+{
+    for (int i = 0; i < DRUM_VOICE_NUM; i++)
+    {
+        drum_voice_t *dv = &drum_voice[i];
+        if (dv->data == NULL)
+        {
+            continue;
+        }
+
+        // Silence until the start delay runs out, then as much of the sample as fits
+        size_t start = (dv->delay < frames) ? dv->delay : frames;
+        dv->delay -= start;
+        size_t count = frames - start;
+        if (count > dv->length - dv->position)
+        {
+            count = dv->length - dv->position;
+        }
+
+        const fp_t *sample = &dv->data[dv->position];
+        const fp2_t gains = fp2_pack(dv->gain_left, dv->gain_right);
+        stereo_t *dst = &out[start];
+        if (gains != 0) // Muted channel: only move on
+        {
+            for (size_t n = 0; n < count; n++)
+            {
+                dst[n].u32 = fp2_add_sat(dst[n].u32, fp2_scale(sample[n], gains));
+            }
+        }
+
+        dv->position += count;
+        if (dv->position >= dv->length)
+        {
+            dv->data = NULL; // Done, the voice is free again
+        }
+    }
+}
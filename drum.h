@@ -0,0 +1,31 @@
+#ifndef DRUM_H
+#define DRUM_H
+
+#include "synthesizer.h"
+
+// One-shot PCM playback for the drum channel, separate from the melodic voices.
+// A drum voice is a sample position and a stereo gain pair fixed at the hit, so rendering
+// costs one load and one multiply-accumulate per output channel and sample.
+// Notes in the same choke group cut each other off (closed/pedal/open hi-hat and the like).
+
+typedef struct
+{
+    const fp_t *data;        // Sample data, NULL when the voice is free
+    uint32_t length;         // Sample length
+    uint32_t position;       // Next sample to play
+    uint32_t delay;          // Silent frames before the sample starts
+    fp_t gain_left;          // Left gain including velocity, channel mixer and pan
+    fp_t gain_right;         // Right gain
+    uint8_t note;            // MIDI note number
+    uint8_t velocity;        // Velocity (0 to 127)
+    uint8_t choke_group;     // Choke group of the note, 0 for none
+} drum_voice_t;
+
+extern drum_voice_t drum_voice[DRUM_VOICE_NUM];
+
+void drum_init();
+void drum_note_on(uint8_t note, uint8_t velocity);
+void drum_update_gains();
+void drum_render(stereo_t *out, size_t frames);
+
+#endif // DRUM_H
@@ -3,6 +3,13 @@
 
 #include <stdint.h>
 
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP && defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define FP2_USE_DSP 1
+#else
+#define FP2_USE_DSP 0
+#endif
+
 typedef int16_t fp_t; // Fixed-point type, 16-bit signed integer
 #define fp_mul(a, b) ((int16_t)(((int32_t)(a) * (int32_t)(b)) >> 15))
 #define fp_div(a, b) ((int16_t)(((int32_t)(a) << 15) / (int32_t)(b)))
@@ -21,4 +28,69 @@ typedef int32_t q8_t;
 #define Q8_MAX ((int32_t)2147483647)
 #define Q8_MIN ((int32_t)-2147483648)
 
+// Pairs of fp_t packed in one word, low half first like the left and right halves of stereo_t.
+// Sums saturate instead of wrapping around. With the Cortex-M33 DSP extension each helper is one or
+// two dual 16-bit instructions (QADD16, SMULBB/SMULBT, SMLAD), the C versions give the same results.
+typedef uint32_t fp2_t;
+
+static inline fp_t fp_sat(int32_t a)
+{
+    return (fp_t)(a > FP_MAX ? FP_MAX : (a < FP_MIN ? FP_MIN : a));
+}
+
+static inline fp2_t fp2_pack(fp_t low, fp_t high)
+{
+    return (uint16_t)low | ((uint32_t)(uint16_t)high << 16);
+}
+
+// Pack the upper halves of two 16.16 values, as used for the ramped voice gains
+static inline fp2_t fp2_pack_upper(int32_t low, int32_t high)
+{
+    return ((uint32_t)high & 0xffff0000u) | ((uint32_t)low >> 16);
+}
+
+static inline fp_t fp2_low(fp2_t a)
+{
+    return (fp_t)(a & 0xffff);
+}
+
+static inline fp_t fp2_high(fp2_t a)
+{
+    return (fp_t)(a >> 16);
+}
+
+// Saturating sum of both halves (QADD16)
+static inline fp2_t fp2_add_sat(fp2_t a, fp2_t b)
+{
+#if FP2_USE_DSP
+    return (fp2_t)__qadd16((int16x2_t)a, (int16x2_t)b);
+#else
+    return fp2_pack(fp_sat(fp2_low(a) + fp2_low(b)), fp_sat(fp2_high(a) + fp2_high(b)));
+#endif
+}
+
+// One sample times both halves of a gain pair, fp_mul on each (SMULBB and SMULBT)
+static inline fp2_t fp2_scale(fp_t a, fp2_t gains)
+{
+#if FP2_USE_DSP
+    return fp2_pack((fp_t)(__smulbb(a, (int32_t)gains) >> 15), (fp_t)(__smulbt(a, (int32_t)gains) >> 15));
+#else
+    return fp2_pack(fp_mul(a, fp2_low(gains)), fp_mul(a, fp2_high(gains)));
+#endif
+}
+
+// Both halves of a times both halves of b, summed and saturated (SMLAD), e.g. a dry/wet mix
+static inline fp_t fp2_dot_sat(fp2_t a, fp2_t b)
+{
+#if FP2_USE_DSP
+    int32_t sum = __smlad((int16x2_t)a, (int16x2_t)b, 0);
+#else
+    int32_t sum = (int32_t)((uint32_t)(fp2_low(a) * fp2_low(b)) + (uint32_t)(fp2_high(a) * fp2_high(b)));
+#endif
+    return fp_sat(sum >> 15);
+}
+
+typedef uint32_t phase_t; // Oscillator phase, one waveform cycle spans the whole 32-bit range
+#define phase_mul_q8(a, b) ((phase_t)(((uint64_t)(a) * (uint64_t)(b)) >> 8))
+
 #endif // COMMON_FUNCTION_H
\ No newline at end of file
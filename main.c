@@ -4,29 +4,97 @@
 #include "hardware/clocks.h"
 #include "hardware/uart.h"
 #include "hardware/vreg.h"
+#include "pico/multicore.h"
 #include <math.h>
 
 #include "audio_dac.pio.h"
 #include "synthesizer.h"
+#include "audio_output.h"
 #include "midi.h"
+#include "midi_uart.h"
+#include "render_split.h"
 
 #define PLL_SYS_KHZ 380 * 1000
 
+// Print render times for a growing number of voices on one and on both cores at boot (see README.md)
+#ifndef RENDER_BENCHMARK
+#define RENDER_BENCHMARK 0
+#endif
+
 // UART(for debugging)
 #define UART_ID uart0
 #define BAUD_RATE 115200
 #define UART_TX_PIN 12
 #define UART_RX_PIN 13
 
-bool timer_callback(struct repeating_timer *t)
+// Render callback for the audio output, called whenever a DMA buffer needs new samples
+void audio_render(stereo_t *buffer, size_t frames)
 {
     gpio_put(15, 1); // measure processing time
-    stereo_t data = master(voice_state);
-    pio_sm_put_blocking(pio0, 0, data.u32);
+    render_block(buffer, frames);
     gpio_put(15, 0); // end of processing time measurement
-    return true;
 }
 
+#if AUDIO_ON_CORE1
+static PIO audio_pio;
+static uint audio_sm;
+
+#if RENDER_BENCHMARK && RENDER_SPLIT
+// Average render time of one block, with the given number of sawtooth voices holding a note
+static uint32_t render_benchmark_block_us(int voices)
+{
+    stereo_t buffer[AUDIO_BLOCK_SIZE];
+    init_master();
+    for (int i = 0; i < voices; i++)
+    {
+        midi_t midi = {.ch = i % 8, .event = NOTE_ON, .msg = {NOTE_ON << 4 | (i % 8), 36 + i * 2, 100}};
+        channel_state[midi.ch].tone.osc1.type = SAW;
+        note_on(&midi, voice_state);
+    }
+    render_block_unscheduled(buffer, AUDIO_BLOCK_SIZE); // Settle the cost measurements
+    uint32_t start = time_us_32();
+    for (int n = 0; n < 100; n++)
+    {
+        render_block_unscheduled(buffer, AUDIO_BLOCK_SIZE); // MIDI received meanwhile waits in the buffer
+    }
+    return (time_us_32() - start) / 100;
+}
+
+static void render_benchmark()
+{
+    printf("voices  one core [us/block]  two cores [us/block]  (budget %d us)\n", (int)(AUDIO_BLOCK_SIZE * 1e6f / FS));
+    for (int voices = 4; voices <= MAX_VOICE_NUM; voices += 4)
+    {
+        render_split_enabled = false;
+        uint32_t one = render_benchmark_block_us(voices);
+        render_split_enabled = true;
+        uint32_t two = render_benchmark_block_us(voices);
+        printf("%6d  %19lu  %20lu\n", voices, (unsigned long)one, (unsigned long)two);
+    }
+    init_master();
+}
+#endif
+
+// Core1 owns the synthesizer state and the audio output: it serves the DMA interrupt and renders
+// every block, taking MIDI events from the lock-free event buffer that core0 fills
+static void audio_core_main()
+{
+    init_oscillator_interp(); // Each core has its own interpolators
+#if RENDER_SPLIT
+    render_split_init_core();
+#if RENDER_BENCHMARK
+    render_benchmark();
+#endif
+#endif
+    synthesizer_reset_clock(); // Frame 0 is the first frame the output plays
+    audio_output_init(audio_pio, audio_sm, audio_render);
+    while (true)
+    {
+        audio_output_task();
+    }
+}
+#endif
+
 int main()
 {
     set_sys_clock_48mhz();
@@ -59,23 +127,45 @@ int main()
     PIO pio = pio0;
     uint offset = pio_add_program(pio, &LSBJ16bit_program);
     uint sm = 0;
-    uint clkdiv = 50;
+    float clkdiv = audio_output_pio_clkdiv(); // One stereo frame per sample period (FS)
     LSBJ16bit_program_init(pio, sm, offset, clkdiv, 0);
 
-    // Repeating timer for audio processing
-    // Timer interval is set to 25 microseconds (40 kHz sample rate)
-    struct repeating_timer timer;
-    add_repeating_timer_us(-25, &timer_callback, NULL, &timer);
+    // Build the wave tables once, a MIDI reset keeps them
+    init_oscillator_tables();
 
     // Initialize synthesizer and MIDI buffer
     midi_buffer_init();
     init_master();
 
+    // DIN MIDI input next to USB
+    midi_uart_init();
+
+#if AUDIO_ON_CORE1
+    // DMA streams rendered blocks to the DAC state machine from core1
+    audio_pio = pio;
+    audio_sm = sm;
+    multicore_launch_core1(audio_core_main);
+#if RENDER_SPLIT
+    render_split_init(); // Core0 renders a share of the voices from the FIFO interrupt
+#endif
+
+    printf("hello\n");
+    while (true)
+    {
+        tud_task(); // Also queues received MIDI through tud_midi_rx_cb()
+        midi_uart_task();
+    }
+#else
+    // DMA streams rendered blocks to the DAC state machine
+    synthesizer_reset_clock(); // Frame 0 is the first frame the output plays
+    audio_output_init(pio, sm, audio_render);
+
     printf("hello\n");
     while (true)
     {
-        tud_task();
-        midi_task();
-        synthesizer_task();
+        tud_task(); // Also queues received MIDI through tud_midi_rx_cb()
+        midi_uart_task();
+        audio_output_task(); // Renders, which applies the MIDI events due in the block
     }
+#endif
 }
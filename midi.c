@@ -1,67 +1,252 @@
 #include "midi.h"
+#include "audio_output.h"
 
-#define MIDI_BUFFER_SIZE 512
-midi_t midi_buffer[MIDI_BUFFER_SIZE];
-uint32_t midi_buffer_head = 0;
-uint32_t midi_buffer_tail = 0;
+#include <stdatomic.h>
 
+_Static_assert((MIDI_BUFFER_SIZE & MIDI_BUFFER_MASK) == 0, "MIDI_BUFFER_SIZE must be a power of two");
+
+// Free running indices, masked on access, so head - tail is the fill level even after wrapping
+static midi_t midi_buffer[MIDI_BUFFER_SIZE];
+static atomic_uint_fast32_t midi_buffer_head; // Written by the producer only
+static atomic_uint_fast32_t midi_buffer_tail; // Written by the consumer only
+midi_buffer_stats_t midi_buffer_stats;
+
+// Coalescing state, consumer side: the next slot to look at, and per channel the slots holding the
+// latest pending value of each controller kind since the last note or sustain event
+#define MIDI_COALESCE_KINDS 6
+static uint32_t midi_coalesce_next;
+static uint8_t midi_coalesce_pending[16];
+static uint32_t midi_coalesce_slot[16][MIDI_COALESCE_KINDS];
+
+static void midi_coalesce_reset(uint32_t next)
+{
+    midi_coalesce_next = next;
+    for (int ch = 0; ch < 16; ch++)
+    {
+        midi_coalesce_pending[ch] = 0;
+    }
+}
+
+// Call before the producer and the consumer start
 void midi_buffer_init()
 {
-    midi_buffer_head = 0;
-    midi_buffer_tail = 0;
-    for (int i = 0; i < MIDI_BUFFER_SIZE; i++)
+    atomic_store_explicit(&midi_buffer_head, 0, memory_order_relaxed);
+    atomic_store_explicit(&midi_buffer_tail, 0, memory_order_relaxed);
+    midi_coalesce_reset(0);
+    midi_buffer_stats.overflows = 0;
+    midi_buffer_stats.high_water = 0;
+    midi_buffer_stats.coalesced = 0;
+    midi_buffer_stats.late = 0;
+}
+
+bool midi_buffer_push(midi_t midi)
+{
+    uint32_t head = atomic_load_explicit(&midi_buffer_head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&midi_buffer_tail, memory_order_acquire); // Slot is read before reuse
+    uint32_t count = head - tail;
+    if (count >= MIDI_BUFFER_SIZE)
+    {
+        midi_buffer_stats.overflows++; // Keep the older events, a late note off beats a lost one
+        return false;
+    }
+
+    midi_buffer[head & MIDI_BUFFER_MASK] = midi;
+    atomic_store_explicit(&midi_buffer_head, head + 1, memory_order_release); // Publish the slot
+
+    if (count + 1 > midi_buffer_stats.high_water)
     {
-        midi_buffer[i].ch = 0;
-        midi_buffer[i].event = 0;
-        midi_buffer[i].msg[0] = 0;
-        midi_buffer[i].msg[1] = 0;
-        midi_buffer[i].msg[2] = 0;
+        midi_buffer_stats.high_water = count + 1;
     }
+    return true;
 }
 
-void midi_buffer_push(midi_t midi)
+bool midi_buffer_peek(midi_t *midi)
 {
-    midi_buffer[midi_buffer_head] = midi;
-    midi_buffer_head = (midi_buffer_head + 1) % MIDI_BUFFER_SIZE;
+    uint32_t tail = atomic_load_explicit(&midi_buffer_tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&midi_buffer_head, memory_order_acquire); // Slot contents are visible
+    uint32_t first = tail;
+    while (tail != head && midi_buffer[tail & MIDI_BUFFER_MASK].event == SUPERSEDED)
+    {
+        tail++;
+    }
+    if (tail != first)
+    {
+        atomic_store_explicit(&midi_buffer_tail, tail, memory_order_release); // Hand the skipped slots back
+    }
+    if (head == tail)
+    {
+        return false;
+    }
+
+    *midi = midi_buffer[tail & MIDI_BUFFER_MASK];
+    return true;
+}
+
+bool midi_buffer_pop(midi_t *midi)
+{
+    if (!midi_buffer_peek(midi))
+    {
+        return false;
+    }
+    uint32_t tail = atomic_load_explicit(&midi_buffer_tail, memory_order_relaxed);
+    atomic_store_explicit(&midi_buffer_tail, tail + 1, memory_order_release); // Hand the slot back
+    return true;
 }
 
-midi_t midi_buffer_pop()
+void midi_buffer_flush()
 {
-    midi_t midi = midi_buffer[midi_buffer_tail];
-    midi_buffer_tail = (midi_buffer_tail + 1) % MIDI_BUFFER_SIZE;
-    return midi;
+    uint32_t head = atomic_load_explicit(&midi_buffer_head, memory_order_acquire);
+    atomic_store_explicit(&midi_buffer_tail, head, memory_order_release);
+    midi_coalesce_reset(head);
 }
 
-bool midi_buffer_empty()
+// Controllers where only the latest value matters, as a bit per kind, or 0 for other events
+static uint8_t midi_coalesce_kind(const midi_t *midi)
 {
-    return midi_buffer_head == midi_buffer_tail;
+    switch (midi->event)
+    {
+    case PITCH_BEND:
+        return 1 << 0;
+    case CHANNEL_PRESSURE:
+        return 1 << 1;
+    case CONTROL_CHANGE:
+        switch (midi->msg[1])
+        {
+        case 1: // Modulation
+            return 1 << 2;
+        case 7: // Volume
+            return 1 << 3;
+        case 10: // Pan
+            return 1 << 4;
+        case 11: // Expression
+            return 1 << 5;
+        default:
+            return 0;
+        }
+    default:
+        return 0;
+    }
 }
 
+// Notes and sustain pedal changes must hear the controller values sent before them
+static bool midi_coalesce_barrier(const midi_t *midi)
+{
+    return midi->event == NOTE_ON || midi->event == NOTE_OFF ||
+           (midi->event == CONTROL_CHANGE && midi->msg[1] == 64);
+}
+
+// Look at the pending events stamped before until that have not been seen yet, from oldest to newest,
+// and mark a pitch bend, channel pressure or CC 1/7/10/11 as superseded when the same channel sends
+// the same controller again without a note or sustain event in between. Every event is looked at once,
+// so a dense controller stream costs a constant amount per event however often this is called.
+// Events stamped later are still in the future and keep their own timing. Only the consumer owns the
+// published slots, so they can be changed in place while the producer keeps appending.
+void midi_buffer_coalesce(uint32_t until)
+{
+    uint32_t tail = atomic_load_explicit(&midi_buffer_tail, memory_order_relaxed);
+    uint32_t head = atomic_load_explicit(&midi_buffer_head, memory_order_acquire);
+    uint32_t i = midi_coalesce_next;
+    if ((int32_t)(i - tail) < 0)
+    {
+        i = tail; // Events taken without being looked at (stamped ahead of the render clock)
+    }
+
+    for (; i != head && (int32_t)(midi_buffer[i & MIDI_BUFFER_MASK].timestamp - until) < 0; i++)
+    {
+        midi_t *midi = &midi_buffer[i & MIDI_BUFFER_MASK];
+        if (midi->event >= 0xf0)
+        {
+            continue;
+        }
+        if (midi_coalesce_barrier(midi))
+        {
+            midi_coalesce_pending[midi->ch] = 0;
+            continue;
+        }
+        uint8_t kind = midi_coalesce_kind(midi);
+        if (kind == 0)
+        {
+            continue;
+        }
+
+        // The earlier value is superseded unless it has been applied already
+        uint32_t *slot = &midi_coalesce_slot[midi->ch][__builtin_ctz(kind)];
+        if ((midi_coalesce_pending[midi->ch] & kind) && (int32_t)(*slot - tail) >= 0)
+        {
+            midi_buffer[*slot & MIDI_BUFFER_MASK].event = SUPERSEDED;
+            midi_buffer_stats.coalesced++;
+        }
+        midi_coalesce_pending[midi->ch] |= kind;
+        *slot = i;
+    }
+    midi_coalesce_next = i;
+}
+
+// Queue a MIDI message, msg holds the status byte and up to two data bytes (unused bytes zero)
 bool midi_event(uint8_t *msg)
 {
     midi_t midi;
 
+    midi.timestamp = audio_output_frame();
     midi.ch = msg[0] & 0xf;
     midi.event = msg[0] >= 0xf0 ? msg[0] : (msg[0] >> 4) & 0xf;
     midi.msg[0] = msg[0];
     midi.msg[1] = msg[1];
     midi.msg[2] = msg[2];
-    midi_buffer_push(midi);
+    return midi_buffer_push(midi);
 }
 
-void midi_task()
-{
-    uint8_t msg[3];
-    int n_data;
+// MIDI bytes carried by a USB-MIDI event packet for each Code Index Number (0 for reserved CINs)
+static const uint8_t usb_midi_cin_length[16] = {0, 0, 2, 3, 3, 1, 2, 3, 3, 3, 3, 3, 2, 2, 3, 1};
+
+static bool usb_midi_in_sysex = false;
 
-    while (n_data = tud_midi_n_available(0, 0))
+// Turn one USB-MIDI event packet (cable/CIN byte and three MIDI bytes) into a queued event.
+// SysEx is not used by the synthesizer: its packets are skipped as a whole, so data bytes are
+// never mistaken for messages.
+static void usb_midi_packet(const uint8_t packet[4])
+{
+    uint8_t cin = packet[0] & 0xf;
+    switch (cin)
     {
-        msg[0] = 0;
-        msg[1] = 0;
-        msg[2] = 0;
-        if (n_data = tud_midi_n_stream_read(0, 0, msg, 3))
+    case 0x4: // SysEx starts or continues
+        usb_midi_in_sysex = true;
+        return;
+    case 0x5: // SysEx ends with one byte, or a single byte System Common message
+        if (usb_midi_in_sysex || packet[1] == SYS_EX_END)
         {
-            midi_event(msg);
+            usb_midi_in_sysex = false;
+            return;
         }
+        break;
+    case 0x6: // SysEx ends with two or three bytes
+    case 0x7:
+        usb_midi_in_sysex = false;
+        return;
+    default:
+        break;
+    }
+
+    uint8_t length = usb_midi_cin_length[cin];
+    if (length == 0 || packet[1] < 0x80)
+    {
+        return; // Reserved CIN or no status byte
     }
-}
\ No newline at end of file
+    uint8_t msg[3] = {packet[1], 0, 0};
+    for (uint8_t i = 1; i < length; i++)
+    {
+        msg[i] = packet[1 + i];
+    }
+    midi_event(msg);
+}
+
+// TinyUSB calls this from tud_task() as soon as a MIDI OUT transfer has been received.
+// Whole packets go straight into the event buffer, each stamped with the audio frame when it is read.
+void tud_midi_rx_cb(uint8_t itf)
+{
+    uint8_t packet[4];
+    while (tud_midi_n_packet_read(itf, packet))
+    {
+        usb_midi_packet(packet);
+    }
+}
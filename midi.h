@@ -8,6 +8,7 @@
 
 typedef enum
 {
+    SUPERSEDED = 0x0, // Coalesced into a later event of the same kind, never popped
     NOTE_OFF = 0x8,
     NOTE_ON = 0x9,
     POLY_PRESSURE = 0xa,
@@ -35,17 +36,37 @@ typedef enum
 
 typedef struct
 {
+    uint32_t timestamp; // audio_output_frame() when the event arrived
     uint8_t ch;
     uint8_t event;
     uint8_t msg[3];
 } midi_t;
 
+// Single producer, single consumer ring between the MIDI input and the synthesizer.
+// The producer only writes the head and the consumer only the tail, with release stores
+// publishing the slot contents, so no lock is needed across an interrupt or the other core.
+// Producer: the MIDI inputs (midi_event). Consumer: render_block(), which applies the events
+// and so is the only writer of the synthesizer state; peek, pop, flush and coalesce belong to it.
+#define MIDI_BUFFER_SIZE 512 // Must be a power of two
+#define MIDI_BUFFER_MASK (MIDI_BUFFER_SIZE - 1)
+
+typedef struct
+{
+    volatile uint32_t overflows;  // Events dropped because the buffer was full
+    volatile uint32_t high_water; // Most events ever waiting in the buffer
+    volatile uint32_t coalesced;  // Events dropped because a later one of the same kind replaced them
+    volatile uint32_t late;       // Events applied after their scheduled frame
+} midi_buffer_stats_t;
+
+extern midi_buffer_stats_t midi_buffer_stats;
+
 void midi_buffer_init();
-void midi_buffer_push(midi_t midi);
-midi_t midi_buffer_pop();
-bool midi_buffer_empty();
+bool midi_buffer_push(midi_t midi); // Producer side, false if the event was dropped
+bool midi_buffer_peek(midi_t *midi); // Consumer side, the oldest event without taking it
+bool midi_buffer_pop(midi_t *midi);  // Consumer side, false if the buffer is empty
+void midi_buffer_flush();           // Consumer side, drops all pending events
+void midi_buffer_coalesce(uint32_t until); // Consumer side, drops stale controller values stamped before until
 
 bool midi_event(uint8_t *msg);
-void midi_task();
 
 #endif
\ No newline at end of file
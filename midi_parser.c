@@ -0,0 +1,98 @@
+#include "midi_parser.h"
+
+void midi_parser_init(midi_parser_t *parser)
+{
+    parser->status = 0;
+    parser->expected = 0;
+    parser->count = 0;
+    parser->in_sysex = false;
+}
+
+// Data bytes that follow a status byte, or -1 for status bytes that carry no message
+static int midi_parser_data_length(uint8_t status)
+{
+    if (status < 0xf0)
+    {
+        uint8_t event = status >> 4;
+        return (event == 0xc || event == 0xd) ? 1 : 2; // Program change and channel pressure take one
+    }
+    switch (status)
+    {
+    case 0xf1: // MTC quarter frame
+    case 0xf3: // Song select
+        return 1;
+    case 0xf2: // Song position
+        return 2;
+    case 0xf6: // Tune request
+        return 0;
+    default:
+        return -1; // Undefined 0xf4 and 0xf5
+    }
+}
+
+bool midi_parser_byte(midi_parser_t *parser, uint8_t byte, uint8_t msg[3])
+{
+    if (byte >= 0xf8)
+    {
+        // Real-time messages may come between any two bytes and leave the message in progress alone
+        if (byte == 0xf9 || byte == 0xfd)
+        {
+            return false; // Undefined
+        }
+        msg[0] = byte;
+        msg[1] = 0;
+        msg[2] = 0;
+        return true;
+    }
+
+    if (byte >= 0x80)
+    {
+        // Any other status byte ends SysEx and the running status
+        parser->in_sysex = (byte == 0xf0);
+        parser->status = 0;
+        parser->count = 0;
+        if (byte == 0xf0 || byte == 0xf7)
+        {
+            return false;
+        }
+
+        int length = midi_parser_data_length(byte);
+        if (length < 0)
+        {
+            return false;
+        }
+        parser->status = byte;
+        parser->expected = (uint8_t)length;
+        if (length > 0)
+        {
+            return false;
+        }
+        // Tune request is complete on its own
+        msg[0] = byte;
+        msg[1] = 0;
+        msg[2] = 0;
+        parser->status = 0;
+        return true;
+    }
+
+    // Data byte
+    if (parser->in_sysex || parser->status == 0)
+    {
+        return false; // SysEx payload, or no status to attach it to
+    }
+    parser->data[parser->count++] = byte;
+    if (parser->count < parser->expected)
+    {
+        return false;
+    }
+
+    msg[0] = parser->status;
+    msg[1] = parser->data[0];
+    msg[2] = (parser->expected == 2) ? parser->data[1] : 0;
+    parser->count = 0;
+    if (parser->status >= 0xf0)
+    {
+        parser->status = 0; // System common messages do not set a running status
+    }
+    return true;
+}
@@ -0,0 +1,26 @@
+#ifndef MIDI_PARSER_H
+#define MIDI_PARSER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Streaming MIDI 1.0 byte parser for serial (DIN) input. Handles running status, real-time
+// bytes in the middle of a message and SysEx, which is skipped. It only depends on the C
+// library, so recorded byte streams can be fed to it on a host.
+
+typedef struct
+{
+    uint8_t status;   // Status of the message being received, 0 when waiting for a status byte
+    uint8_t expected; // Data bytes the status needs
+    uint8_t count;    // Data bytes received so far
+    uint8_t data[2];  // Data bytes received so far
+    bool in_sysex;    // Between SysEx start and end
+} midi_parser_t;
+
+void midi_parser_init(midi_parser_t *parser);
+
+// Feed one byte. Returns true with the status and data bytes in msg (unused bytes zero)
+// when the byte completes a message.
+bool midi_parser_byte(midi_parser_t *parser, uint8_t byte, uint8_t msg[3]);
+
+#endif // MIDI_PARSER_H
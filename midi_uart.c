@@ -0,0 +1,50 @@
+#include "midi_uart.h"
+#include "hardware/dma.h"
+#include "midi.h"
+#include "midi_parser.h"
+
+// The DMA write address wraps inside the ring, which therefore has to be aligned to its size
+static uint8_t midi_uart_ring[MIDI_UART_RING_SIZE] __attribute__((aligned(MIDI_UART_RING_SIZE)));
+static uint midi_uart_dma_channel;
+static uint32_t midi_uart_read_index;
+static midi_parser_t midi_uart_parser;
+
+void midi_uart_init()
+{
+    uart_init(MIDI_UART_ID, MIDI_UART_BAUD_RATE);
+    uart_set_format(MIDI_UART_ID, 8, 1, UART_PARITY_NONE);
+    uart_set_fifo_enabled(MIDI_UART_ID, true);
+    gpio_set_function(MIDI_UART_RX_PIN, GPIO_FUNC_UART);
+    gpio_pull_up(MIDI_UART_RX_PIN); // Line idles high while no cable is plugged in
+
+    midi_parser_init(&midi_uart_parser);
+    midi_uart_read_index = 0;
+
+    // Runs forever: one byte per RX DREQ, written around the ring
+    midi_uart_dma_channel = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(midi_uart_dma_channel);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, MIDI_UART_RING_BITS);
+    channel_config_set_dreq(&c, uart_get_dreq(MIDI_UART_ID, false));
+    dma_channel_configure(midi_uart_dma_channel, &c, midi_uart_ring, &uart_get_hw(MIDI_UART_ID)->dr,
+                          dma_encode_endless_transfer_count(), true);
+}
+
+// Parse the bytes received since the last call. Runs in the main loop next to tud_task(),
+// so both MIDI sources push into the event buffer from the same context.
+void midi_uart_task()
+{
+    uint32_t write_index = (dma_channel_hw_addr(midi_uart_dma_channel)->write_addr - (uintptr_t)midi_uart_ring) & (MIDI_UART_RING_SIZE - 1);
+    uint8_t msg[3];
+    while (midi_uart_read_index != write_index)
+    {
+        uint8_t byte = midi_uart_ring[midi_uart_read_index];
+        midi_uart_read_index = (midi_uart_read_index + 1) & (MIDI_UART_RING_SIZE - 1);
+        if (midi_parser_byte(&midi_uart_parser, byte, msg))
+        {
+            midi_event(msg);
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef MIDI_UART_H
+#define MIDI_UART_H
+
+#include "pico/stdlib.h"
+#include "hardware/uart.h"
+
+// DIN MIDI input on a UART. A DMA channel copies every received byte into a ring buffer without
+// CPU involvement, and midi_uart_task() parses what has arrived into the MIDI event buffer.
+// uart0 stays with the debug printf output.
+#define MIDI_UART_ID uart1
+#define MIDI_UART_RX_PIN 5
+#define MIDI_UART_BAUD_RATE 31250
+#define MIDI_UART_RING_BITS 8 // 256 bytes, about 80 ms of continuous input at 31250 baud
+#define MIDI_UART_RING_SIZE (1 << MIDI_UART_RING_BITS)
+
+void midi_uart_init();
+void midi_uart_task();
+
+#endif // MIDI_UART_H
@@ -0,0 +1,128 @@
+#include <math.h>
+#include "oscillator.h"
+
+fp_t sin_table[TABLE_LENGTH + 1];
+fp_t mipmap_table[MIPMAP_SHAPES][MIPMAP_LEVELS][TABLE_LENGTH + 1];
+
+// Sum the Fourier series of a shape one harmonic at a time and store a table each time a level's highest
+// harmonic is reached. Harmonics are read from sin_table, which is exact for whole multiples of the cycle.
+static void build_mipmap(int shape)
+{
+    static float sum[TABLE_LENGTH];
+    float scale;
+
+    // sin_table is full scale. The sawtooth overshoots by about 18% next to its jump (Gibbs phenomenon) and
+    // the square by up to 27% (its fundamental alone), so they are scaled down to fit.
+    switch (shape)
+    {
+    case 0: // Square: 4/pi * sum(sin(h x) / h), odd h, +1 on the first half
+        scale = 4.0f / (float)M_PI / 1.28f;
+        break;
+    case 1: // Sawtooth: -2/pi * sum(sin(h x) / h), rises from -1 to +1
+        scale = -2.0f / (float)M_PI / 1.18f;
+        break;
+    default: // Triangle: 8/pi^2 * sum(cos(h x) / h^2), odd h, +1 at the cycle start
+        scale = 8.0f / (float)(M_PI * M_PI);
+        break;
+    }
+
+    for (int i = 0; i < TABLE_LENGTH; i++)
+    {
+        sum[i] = 0.0f;
+    }
+
+    for (int h = 1, level = MIPMAP_LEVELS - 1; level >= 0; h++)
+    {
+        if (shape == 1 || (h & 1))
+        {
+            float gain = (shape == 2) ? scale / (float)(h * h) : scale / (float)h;
+            uint32_t offset = (shape == 2) ? TABLE_LENGTH / 4 : 0; // Cosine for the triangle
+            for (int i = 0; i < TABLE_LENGTH; i++)
+            {
+                sum[i] += gain * sin_table[(h * i + offset) & (TABLE_LENGTH - 1)];
+            }
+        }
+
+        if (h == (TABLE_LENGTH / 2) >> level)
+        {
+            fp_t *table = mipmap_table[shape][level];
+            for (int i = 0; i < TABLE_LENGTH; i++)
+            {
+                long value = lroundf(sum[i]);
+                table[i] = (fp_t)((value > FP_MAX) ? FP_MAX : (value < FP_MIN) ? FP_MIN : value);
+            }
+            table[TABLE_LENGTH] = table[0];
+            level--;
+        }
+    }
+}
+
+// Unfold the stored quarter wave into a full sine cycle and build the band-limited tables from it
+void init_oscillator_tables()
+{
+    for (int i = 0; i < TABLE_LENGTH; i++)
+    {
+        int quarter = i / SIN_QUARTER_LENGTH;
+        int offset = i % SIN_QUARTER_LENGTH;
+        fp_t value = (quarter & 1) ? sin_quarter_table[SIN_QUARTER_LENGTH - offset] : sin_quarter_table[offset];
+        sin_table[i] = (quarter & 2) ? -value : value;
+    }
+    sin_table[TABLE_LENGTH] = sin_table[0];
+
+    for (int shape = 0; shape < MIPMAP_SHAPES; shape++)
+    {
+        build_mipmap(shape);
+    }
+}
+
+// Phase increment for a pitch, 2^(pitch / 12) times the increment of note 0. Pitches below note 0 play note 0
+// and increments are limited to FS / 2.
+phase_t osc_pitch_increment(pitch_t pitch)
+{
+    if (pitch < 0)
+    {
+        pitch = 0;
+    }
+
+    uint32_t note = (uint32_t)pitch >> PITCH_NOTE_SHIFT;
+    uint32_t octave = note / 12;
+    uint32_t fraction = (uint32_t)pitch & (PITCH_SEMITONE - 1);
+
+    // 2^(fraction / 12) from the step table, interpolated over the bits below the step
+    const int weight_bits = PITCH_NOTE_SHIFT - PITCH_STEP_BITS;
+    const uint32_t *step = &pitch_fraction_table[fraction >> weight_bits];
+    uint32_t weight = fraction & ((1u << weight_bits) - 1);
+    uint32_t ratio = step[0] + (((step[1] - step[0]) * weight) >> weight_bits); // Q31
+
+    uint64_t increment = (uint64_t)pitch_semitone_table[note - octave * 12] * ratio;
+    int shift = 31 + PITCH_SEMITONE_SHIFT - (int)octave;
+    if (shift <= 0 || (increment >> shift) > 0x80000000u)
+    {
+        return 0x80000000u;
+    }
+    return (phase_t)(increment >> shift);
+}
+
+// Set up the interpolators of the calling core for osc_stream_next(). Must run on the core that renders.
+void init_oscillator_interp()
+{
+#if OSC_USE_INTERP
+    for (int unit = 0; unit < 2; unit++)
+    {
+        interp_hw_t *interp = unit ? interp1 : interp0;
+
+        // Lane 0: ACCUM0 += BASE0 on every pop, FULL gets the byte offset of the table entry
+        interp_config cfg = interp_default_config();
+        interp_config_set_add_raw(&cfg, true);
+        interp_config_set_shift(&cfg, PHASE_INDEX_SHIFT - 1);
+        interp_config_set_mask(&cfg, 1, TABLE_LENGTH_BITS);
+        interp_set_config(interp, 0, &cfg);
+
+        // Lane 1 is unused and must add nothing to FULL
+        cfg = interp_default_config();
+        interp_set_config(interp, 1, &cfg);
+        interp->accum[1] = 0;
+        interp->base[1] = 0;
+    }
+#endif
+}
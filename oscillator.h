@@ -0,0 +1,163 @@
+#ifndef OSCILLATOR_H
+#define OSCILLATOR_H
+
+#include <stdint.h>
+#include "fp.h"
+#include "wave_table.h"
+
+// Waveform generators for the voice kernels. Each takes a 32-bit phase where one cycle spans the whole range.
+// Sine, square, sawtooth and triangle read full cycle tables built in SRAM at boot: the sine is unfolded from
+// sin_quarter_table, the other shapes are summed from sine harmonics into one band-limited table per octave.
+
+// Table reads blend the two entries around the phase using the bits below the index (one multiply per read).
+// This keeps the sine error below 16-bit quantization with a 512 entry table. Set to 0 to truncate the
+// phase instead, which needs a 4096 entry table for similar quality (see tools/wave_table.py).
+#ifndef OSC_INTERPOLATE
+#define OSC_INTERPOLATE 1
+#endif
+
+// Table oscillator streams use the SIO interpolators (INTERP0 for osc1, INTERP1 for osc2) to add the
+// phase increment and form the table entry address. Elsewhere the same arithmetic runs in C, giving
+// identical output, so the kernels also build and run on a host.
+#ifndef OSC_USE_INTERP
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#define OSC_USE_INTERP 1
+#else
+#define OSC_USE_INTERP 0
+#endif
+#endif
+
+#if OSC_USE_INTERP
+#include "hardware/interp.h"
+#endif
+
+#define PHASE_INDEX_SHIFT (32 - TABLE_LENGTH_BITS) // Phase bits below the wave table index
+#define PHASE_FRACTION_BITS 15                     // Interpolation weight resolution (Q15)
+
+// Band-limited tables: level L holds harmonics up to TABLE_LENGTH / 2 >> L, the last level is a plain sine
+#define MIPMAP_LEVELS TABLE_LENGTH_BITS
+#define MIPMAP_SHAPES 3 // Square, sawtooth and triangle
+
+extern fp_t sin_table[TABLE_LENGTH + 1]; // One sine cycle plus a copy of the first entry for interpolation
+extern fp_t mipmap_table[MIPMAP_SHAPES][MIPMAP_LEVELS][TABLE_LENGTH + 1];
+
+// Pitches are in 1/65536 semitones above MIDI note 0 (pitch_t), so whole notes are note << PITCH_NOTE_SHIFT
+typedef int32_t pitch_t;
+#define PITCH_NOTE_SHIFT 16
+#define PITCH_SEMITONE ((pitch_t)1 << PITCH_NOTE_SHIFT)
+
+void init_oscillator_tables();
+void init_oscillator_interp();
+phase_t osc_pitch_increment(pitch_t pitch);
+
+// Interpolation weight of the entry after the phase's table index
+static inline int32_t osc_phase_fraction(phase_t phase)
+{
+    return (int32_t)((phase >> (PHASE_INDEX_SHIFT - PHASE_FRACTION_BITS)) & ((1 << PHASE_FRACTION_BITS) - 1));
+}
+
+// Read a full cycle table at the phase entry (table must hold TABLE_LENGTH + 1 entries)
+static inline fp_t osc_table_read(const fp_t *entry, phase_t phase)
+{
+#if OSC_INTERPOLATE
+    int32_t value = entry[0];
+    return (fp_t)(value + (((entry[1] - value) * osc_phase_fraction(phase)) >> PHASE_FRACTION_BITS));
+#else
+    (void)phase;
+    return entry[0];
+#endif
+}
+
+static inline fp_t osc_sin(phase_t phase)
+{
+    return osc_table_read(&sin_table[phase >> PHASE_INDEX_SHIFT], phase);
+}
+
+// Band-limited table for a mipmap shape (0 square, 1 sawtooth, 2 triangle) played with a phase increment.
+// Picks the richest level whose highest harmonic stays below FS / 2, i.e. harmonics * increment < 2^31.
+static inline const fp_t *osc_mipmap_table(int shape, phase_t increment)
+{
+    int level = (increment != 0) ? TABLE_LENGTH_BITS - __builtin_clz(increment) : 0;
+    if (level < 0)
+    {
+        level = 0;
+    }
+    else if (level >= MIPMAP_LEVELS)
+    {
+        level = MIPMAP_LEVELS - 1;
+    }
+    return mipmap_table[shape][level];
+}
+
+// Phase accumulator running through a wave table for one block
+typedef struct
+{
+#if OSC_USE_INTERP
+    interp_hw_t *interp; // ACCUM0 holds the phase, BASE0 the increment and BASE2 the table
+#else
+    const fp_t *table;
+    phase_t phase;
+    phase_t increment;
+#endif
+} osc_stream_t;
+
+// unit selects the interpolator: 0 for osc1, 1 for osc2
+static inline void osc_stream_start(osc_stream_t *stream, int unit, const fp_t *table, phase_t phase, phase_t increment)
+{
+#if OSC_USE_INTERP
+    stream->interp = unit ? interp1 : interp0;
+    stream->interp->accum[0] = phase;
+    stream->interp->base[0] = increment;
+    stream->interp->base[2] = (uintptr_t)table;
+#else
+    (void)unit;
+    stream->table = table;
+    stream->phase = phase;
+    stream->increment = increment;
+#endif
+}
+
+static inline void osc_stream_set_increment(osc_stream_t *stream, phase_t increment)
+{
+#if OSC_USE_INTERP
+    stream->interp->base[0] = increment;
+#else
+    stream->increment = increment;
+#endif
+}
+
+static inline phase_t osc_stream_phase(osc_stream_t *stream)
+{
+#if OSC_USE_INTERP
+    return stream->interp->accum[0];
+#else
+    return stream->phase;
+#endif
+}
+
+// Read the table at the current phase and advance the phase by the increment
+static inline fp_t osc_stream_next(osc_stream_t *stream)
+{
+#if OSC_USE_INTERP
+    phase_t phase = stream->interp->accum[0];
+    const fp_t *entry = (const fp_t *)(uintptr_t)stream->interp->pop[2]; // BASE2 + entry offset, ACCUM0 += BASE0
+#else
+    phase_t phase = stream->phase;
+    const fp_t *entry = &stream->table[phase >> PHASE_INDEX_SHIFT];
+    stream->phase = phase + stream->increment;
+#endif
+    return osc_table_read(entry, phase);
+}
+
+// White noise from a xorshift generator, the state must never be zero
+static inline fp_t osc_noise(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return (fp_t)(x >> 16);
+}
+
+#endif // OSCILLATOR_H
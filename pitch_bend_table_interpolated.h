@@ -1,865 +0,0 @@
-#ifndef PITCH_BEND_TABLE_INTERPOLATED_H
-#define PITCH_BEND_TABLE_INTERPOLATED_H
-
-#include "fp.h"
-
-#define PITCH_BEND_INTERPOLATED_TABLE_SIZE 256
-#define PITCH_BEND_ORIGINAL_TABLE_SIZE 16384
-
-// Pitch bend factors (interpolated): Q8 format
-// 2D Array: pitch_bend_factors_interpolated[max_semitones_0_to_24][bend_value_0_to_255]
-// Dimensions: [25][256]
-static const q8_t pitch_bend_factors_interpolated[25][256] = {
-    { // Table for +/- 0 semitones
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256, 
-        256, 256, 256, 256, 256, 256, 256, 256
-    },
-    { // Table for +/- 1 semitones
-        242, 242, 242, 242, 242, 242, 242, 242, 
-        243, 243, 243, 243, 243, 243, 243, 243, 
-        243, 243, 244, 244, 244, 244, 244, 244, 
-        244, 244, 244, 245, 245, 245, 245, 245, 
-        245, 245, 245, 245, 246, 246, 246, 246, 
-        246, 246, 246, 246, 246, 247, 247, 247, 
-        247, 247, 247, 247, 247, 248, 248, 248, 
-        248, 248, 248, 248, 248, 248, 249, 249, 
-        249, 249, 249, 249, 249, 249, 249, 250, 
-        250, 250, 250, 250, 250, 250, 250, 250, 
-        251, 251, 251, 251, 251, 251, 251, 251, 
-        251, 252, 252, 252, 252, 252, 252, 252, 
-        252, 252, 253, 253, 253, 253, 253, 253, 
-        253, 253, 254, 254, 254, 254, 254, 254, 
-        254, 254, 254, 255, 255, 255, 255, 255, 
-        255, 255, 255, 255, 256, 256, 256, 256, 
-        256, 256, 256, 256, 257, 257, 257, 257, 
-        257, 257, 257, 257, 257, 258, 258, 258, 
-        258, 258, 258, 258, 258, 259, 259, 259, 
-        259, 259, 259, 259, 259, 259, 260, 260, 
-        260, 260, 260, 260, 260, 260, 261, 261, 
-        261, 261, 261, 261, 261, 261, 261, 262, 
-        262, 262, 262, 262, 262, 262, 262, 263, 
-        263, 263, 263, 263, 263, 263, 263, 263, 
-        264, 264, 264, 264, 264, 264, 264, 264, 
-        265, 265, 265, 265, 265, 265, 265, 265, 
-        266, 266, 266, 266, 266, 266, 266, 266, 
-        266, 267, 267, 267, 267, 267, 267, 267, 
-        267, 268, 268, 268, 268, 268, 268, 268, 
-        268, 269, 269, 269, 269, 269, 269, 269, 
-        269, 270, 270, 270, 270, 270, 270, 270, 
-        270, 270, 271, 271, 271, 271, 271, 271
-    },
-    { // Table for +/- 2 semitones
-        228, 228, 228, 229, 229, 229, 229, 230, 
-        230, 230, 230, 230, 231, 231, 231, 231, 
-        231, 232, 232, 232, 232, 232, 233, 233, 
-        233, 233, 234, 234, 234, 234, 234, 235, 
-        235, 235, 235, 235, 236, 236, 236, 236, 
-        236, 237, 237, 237, 237, 238, 238, 238, 
-        238, 238, 239, 239, 239, 239, 240, 240, 
-        240, 240, 240, 241, 241, 241, 241, 241, 
-        242, 242, 242, 242, 243, 243, 243, 243, 
-        243, 244, 244, 244, 244, 245, 245, 245, 
-        245, 245, 246, 246, 246, 246, 247, 247, 
-        247, 247, 247, 248, 248, 248, 248, 249, 
-        249, 249, 249, 249, 250, 250, 250, 250, 
-        251, 251, 251, 251, 252, 252, 252, 252, 
-        252, 253, 253, 253, 253, 254, 254, 254, 
-        254, 254, 255, 255, 255, 255, 256, 256, 
-        256, 256, 257, 257, 257, 257, 258, 258, 
-        258, 258, 258, 259, 259, 259, 259, 260, 
-        260, 260, 260, 261, 261, 261, 261, 262, 
-        262, 262, 262, 262, 263, 263, 263, 263, 
-        264, 264, 264, 264, 265, 265, 265, 265, 
-        266, 266, 266, 266, 267, 267, 267, 267, 
-        267, 268, 268, 268, 268, 269, 269, 269, 
-        269, 270, 270, 270, 270, 271, 271, 271, 
-        271, 272, 272, 272, 272, 273, 273, 273, 
-        273, 274, 274, 274, 274, 275, 275, 275, 
-        275, 276, 276, 276, 276, 277, 277, 277, 
-        277, 278, 278, 278, 278, 279, 279, 279, 
-        279, 280, 280, 280, 280, 281, 281, 281, 
-        281, 282, 282, 282, 282, 283, 283, 283, 
-        283, 284, 284, 284, 284, 285, 285, 285, 
-        286, 286, 286, 286, 287, 287, 287, 287
-    },
-    { // Table for +/- 3 semitones
-        215, 216, 216, 216, 216, 217, 217, 217, 
-        218, 218, 218, 219, 219, 219, 219, 220, 
-        220, 220, 221, 221, 221, 222, 222, 222, 
-        222, 223, 223, 223, 224, 224, 224, 225, 
-        225, 225, 225, 226, 226, 226, 227, 227, 
-        227, 228, 228, 228, 229, 229, 229, 229, 
-        230, 230, 230, 231, 231, 231, 232, 232, 
-        232, 233, 233, 233, 234, 234, 234, 235, 
-        235, 235, 235, 236, 236, 236, 237, 237, 
-        237, 238, 238, 238, 239, 239, 239, 240, 
-        240, 240, 241, 241, 241, 242, 242, 242, 
-        243, 243, 243, 244, 244, 244, 245, 245, 
-        245, 246, 246, 246, 247, 247, 247, 248, 
-        248, 248, 249, 249, 249, 250, 250, 250, 
-        251, 251, 251, 252, 252, 252, 253, 253, 
-        253, 254, 254, 254, 255, 255, 255, 256, 
-        256, 257, 257, 257, 258, 258, 258, 259, 
-        259, 259, 260, 260, 260, 261, 261, 261, 
-        262, 262, 263, 263, 263, 264, 264, 264, 
-        265, 265, 265, 266, 266, 266, 267, 267, 
-        268, 268, 268, 269, 269, 269, 270, 270, 
-        270, 271, 271, 272, 272, 272, 273, 273, 
-        273, 274, 274, 275, 275, 275, 276, 276, 
-        276, 277, 277, 278, 278, 278, 279, 279, 
-        279, 280, 280, 281, 281, 281, 282, 282, 
-        283, 283, 283, 284, 284, 284, 285, 285, 
-        286, 286, 286, 287, 287, 288, 288, 288, 
-        289, 289, 290, 290, 290, 291, 291, 291, 
-        292, 292, 293, 293, 293, 294, 294, 295, 
-        295, 295, 296, 296, 297, 297, 297, 298, 
-        298, 299, 299, 300, 300, 300, 301, 301, 
-        302, 302, 302, 303, 303, 304, 304, 304
-    },
-    { // Table for +/- 4 semitones
-        203, 204, 204, 204, 205, 205, 205, 206, 
-        206, 207, 207, 207, 208, 208, 208, 209, 
-        209, 210, 210, 210, 211, 211, 211, 212, 
-        212, 213, 213, 213, 214, 214, 215, 215, 
-        215, 216, 216, 216, 217, 217, 218, 218, 
-        218, 219, 219, 220, 220, 220, 221, 221, 
-        222, 222, 222, 223, 223, 224, 224, 224, 
-        225, 225, 226, 226, 227, 227, 227, 228, 
-        228, 229, 229, 229, 230, 230, 231, 231, 
-        232, 232, 232, 233, 233, 234, 234, 234, 
-        235, 235, 236, 236, 237, 237, 237, 238, 
-        238, 239, 239, 240, 240, 240, 241, 241, 
-        242, 242, 243, 243, 244, 244, 244, 245, 
-        245, 246, 246, 247, 247, 248, 248, 248, 
-        249, 249, 250, 250, 251, 251, 252, 252, 
-        253, 253, 253, 254, 254, 255, 255, 256, 
-        256, 257, 257, 258, 258, 259, 259, 259, 
-        260, 260, 261, 261, 262, 262, 263, 263, 
-        264, 264, 265, 265, 266, 266, 267, 267, 
-        268, 268, 269, 269, 270, 270, 271, 271, 
-        272, 272, 273, 273, 274, 274, 274, 275, 
-        275, 276, 276, 277, 277, 278, 279, 279, 
-        280, 280, 281, 281, 282, 282, 283, 283, 
-        284, 284, 285, 285, 286, 286, 287, 287, 
-        288, 288, 289, 289, 290, 290, 291, 291, 
-        292, 292, 293, 294, 294, 295, 295, 296, 
-        296, 297, 297, 298, 298, 299, 299, 300, 
-        301, 301, 302, 302, 303, 303, 304, 304, 
-        305, 305, 306, 307, 307, 308, 308, 309, 
-        309, 310, 310, 311, 312, 312, 313, 313, 
-        314, 314, 315, 316, 316, 317, 317, 318, 
-        318, 319, 320, 320, 321, 321, 322, 323
-    },
-    { // Table for +/- 5 semitones
-        192, 192, 193, 193, 194, 194, 194, 195, 
-        195, 196, 196, 197, 197, 198, 198, 198, 
-        199, 199, 200, 200, 201, 201, 202, 202, 
-        202, 203, 203, 204, 204, 205, 205, 206, 
-        206, 207, 207, 208, 208, 209, 209, 209, 
-        210, 210, 211, 211, 212, 212, 213, 213, 
-        214, 214, 215, 215, 216, 216, 217, 217, 
-        218, 218, 219, 219, 220, 220, 221, 221, 
-        222, 222, 223, 223, 224, 224, 225, 225, 
-        226, 226, 227, 227, 228, 228, 229, 229, 
-        230, 230, 231, 231, 232, 233, 233, 234, 
-        234, 235, 235, 236, 236, 237, 237, 238, 
-        238, 239, 239, 240, 241, 241, 242, 242, 
-        243, 243, 244, 244, 245, 245, 246, 247, 
-        247, 248, 248, 249, 249, 250, 251, 251, 
-        252, 252, 253, 253, 254, 255, 255, 256, 
-        256, 257, 257, 258, 259, 259, 260, 260, 
-        261, 262, 262, 263, 263, 264, 265, 265, 
-        266, 266, 267, 268, 268, 269, 269, 270, 
-        271, 271, 272, 272, 273, 274, 274, 275, 
-        276, 276, 277, 277, 278, 279, 279, 280, 
-        281, 281, 282, 283, 283, 284, 284, 285, 
-        286, 286, 287, 288, 288, 289, 290, 290, 
-        291, 292, 292, 293, 294, 294, 295, 296, 
-        296, 297, 298, 298, 299, 300, 300, 301, 
-        302, 302, 303, 304, 304, 305, 306, 307, 
-        307, 308, 309, 309, 310, 311, 311, 312, 
-        313, 314, 314, 315, 316, 316, 317, 318, 
-        319, 319, 320, 321, 321, 322, 323, 324, 
-        324, 325, 326, 327, 327, 328, 329, 330, 
-        330, 331, 332, 333, 333, 334, 335, 336, 
-        336, 337, 338, 339, 339, 340, 341, 342
-    },
-    { // Table for +/- 6 semitones
-        181, 182, 182, 183, 183, 183, 184, 184, 
-        185, 186, 186, 187, 187, 188, 188, 189, 
-        189, 190, 190, 191, 191, 192, 192, 193, 
-        193, 194, 194, 195, 195, 196, 196, 197, 
-        197, 198, 199, 199, 200, 200, 201, 201, 
-        202, 202, 203, 203, 204, 205, 205, 206, 
-        206, 207, 207, 208, 209, 209, 210, 210, 
-        211, 211, 212, 213, 213, 214, 214, 215, 
-        215, 216, 217, 217, 218, 218, 219, 220, 
-        220, 221, 221, 222, 223, 223, 224, 224, 
-        225, 226, 226, 227, 227, 228, 229, 229, 
-        230, 231, 231, 232, 232, 233, 234, 234, 
-        235, 236, 236, 237, 238, 238, 239, 240, 
-        240, 241, 241, 242, 243, 243, 244, 245, 
-        245, 246, 247, 247, 248, 249, 249, 250, 
-        251, 252, 252, 253, 254, 254, 255, 256, 
-        256, 257, 258, 258, 259, 260, 261, 261, 
-        262, 263, 263, 264, 265, 266, 266, 267, 
-        268, 268, 269, 270, 271, 271, 272, 273, 
-        274, 274, 275, 276, 277, 277, 278, 279, 
-        280, 280, 281, 282, 283, 283, 284, 285, 
-        286, 287, 287, 288, 289, 290, 290, 291, 
-        292, 293, 294, 294, 295, 296, 297, 298, 
-        298, 299, 300, 301, 302, 303, 303, 304, 
-        305, 306, 307, 308, 308, 309, 310, 311, 
-        312, 313, 313, 314, 315, 316, 317, 318, 
-        319, 319, 320, 321, 322, 323, 324, 325, 
-        326, 326, 327, 328, 329, 330, 331, 332, 
-        333, 334, 335, 335, 336, 337, 338, 339, 
-        340, 341, 342, 343, 344, 345, 346, 347, 
-        348, 349, 349, 350, 351, 352, 353, 354, 
-        355, 356, 357, 358, 359, 360, 361, 362
-    },
-    { // Table for +/- 7 semitones
-        171, 171, 172, 172, 173, 174, 174, 175, 
-        175, 176, 176, 177, 177, 178, 179, 179, 
-        180, 180, 181, 181, 182, 183, 183, 184, 
-        184, 185, 186, 186, 187, 187, 188, 189, 
-        189, 190, 190, 191, 192, 192, 193, 193, 
-        194, 195, 195, 196, 196, 197, 198, 198, 
-        199, 200, 200, 201, 201, 202, 203, 203, 
-        204, 205, 205, 206, 207, 207, 208, 209, 
-        209, 210, 211, 211, 212, 213, 213, 214, 
-        215, 215, 216, 217, 217, 218, 219, 220, 
-        220, 221, 222, 222, 223, 224, 224, 225, 
-        226, 227, 227, 228, 229, 229, 230, 231, 
-        232, 232, 233, 234, 235, 235, 236, 237, 
-        238, 238, 239, 240, 241, 241, 242, 243, 
-        244, 244, 245, 246, 247, 248, 248, 249, 
-        250, 251, 252, 252, 253, 254, 255, 256, 
-        256, 257, 258, 259, 260, 260, 261, 262, 
-        263, 264, 265, 266, 266, 267, 268, 269, 
-        270, 271, 271, 272, 273, 274, 275, 276, 
-        277, 278, 278, 279, 280, 281, 282, 283, 
-        284, 285, 286, 286, 287, 288, 289, 290, 
-        291, 292, 293, 294, 295, 296, 297, 298, 
-        299, 300, 300, 301, 302, 303, 304, 305, 
-        306, 307, 308, 309, 310, 311, 312, 313, 
-        314, 315, 316, 317, 318, 319, 320, 321, 
-        322, 323, 324, 325, 326, 327, 328, 329, 
-        330, 331, 333, 334, 335, 336, 337, 338, 
-        339, 340, 341, 342, 343, 344, 345, 347, 
-        348, 349, 350, 351, 352, 353, 354, 355, 
-        357, 358, 359, 360, 361, 362, 363, 365, 
-        366, 367, 368, 369, 370, 372, 373, 374, 
-        375, 376, 378, 379, 380, 381, 382, 384
-    },
-    { // Table for +/- 8 semitones
-        161, 162, 162, 163, 164, 164, 165, 165, 
-        166, 167, 167, 168, 168, 169, 170, 170, 
-        171, 172, 172, 173, 173, 174, 175, 175, 
-        176, 177, 177, 178, 178, 179, 180, 180, 
-        181, 182, 182, 183, 184, 184, 185, 186, 
-        186, 187, 188, 188, 189, 190, 191, 191, 
-        192, 193, 193, 194, 195, 195, 196, 197, 
-        198, 198, 199, 200, 200, 201, 202, 203, 
-        203, 204, 205, 206, 206, 207, 208, 209, 
-        209, 210, 211, 212, 212, 213, 214, 215, 
-        216, 216, 217, 218, 219, 219, 220, 221, 
-        222, 223, 223, 224, 225, 226, 227, 228, 
-        228, 229, 230, 231, 232, 233, 233, 234, 
-        235, 236, 237, 238, 239, 239, 240, 241, 
-        242, 243, 244, 245, 246, 246, 247, 248, 
-        249, 250, 251, 252, 253, 254, 255, 256, 
-        256, 257, 258, 259, 260, 261, 262, 263, 
-        264, 265, 266, 267, 268, 269, 270, 271, 
-        272, 273, 274, 275, 276, 277, 278, 279, 
-        280, 281, 282, 283, 284, 285, 286, 287, 
-        288, 289, 290, 291, 292, 293, 294, 295, 
-        296, 298, 299, 300, 301, 302, 303, 304, 
-        305, 306, 307, 309, 310, 311, 312, 313, 
-        314, 315, 316, 318, 319, 320, 321, 322, 
-        323, 325, 326, 327, 328, 329, 331, 332, 
-        333, 334, 335, 337, 338, 339, 340, 341, 
-        343, 344, 345, 346, 348, 349, 350, 352, 
-        353, 354, 355, 357, 358, 359, 361, 362, 
-        363, 364, 366, 367, 368, 370, 371, 373, 
-        374, 375, 377, 378, 379, 381, 382, 383, 
-        385, 386, 388, 389, 390, 392, 393, 395, 
-        396, 398, 399, 401, 402, 403, 405, 406
-    },
-    { // Table for +/- 9 semitones
-        152, 153, 153, 154, 155, 155, 156, 157, 
-        157, 158, 159, 159, 160, 161, 161, 162, 
-        162, 163, 164, 164, 165, 166, 167, 167, 
-        168, 169, 169, 170, 171, 171, 172, 173, 
-        173, 174, 175, 176, 176, 177, 178, 178, 
-        179, 180, 181, 181, 182, 183, 184, 184, 
-        185, 186, 187, 187, 188, 189, 190, 190, 
-        191, 192, 193, 194, 194, 195, 196, 197, 
-        198, 198, 199, 200, 201, 202, 202, 203, 
-        204, 205, 206, 207, 208, 208, 209, 210, 
-        211, 212, 213, 214, 214, 215, 216, 217, 
-        218, 219, 220, 221, 221, 222, 223, 224, 
-        225, 226, 227, 228, 229, 230, 231, 232, 
-        233, 234, 235, 235, 236, 237, 238, 239, 
-        240, 241, 242, 243, 244, 245, 246, 247, 
-        248, 249, 250, 251, 252, 253, 254, 255, 
-        257, 258, 259, 260, 261, 262, 263, 264, 
-        265, 266, 267, 268, 269, 270, 272, 273, 
-        274, 275, 276, 277, 278, 279, 281, 282, 
-        283, 284, 285, 286, 288, 289, 290, 291, 
-        292, 293, 295, 296, 297, 298, 299, 301, 
-        302, 303, 304, 306, 307, 308, 309, 311, 
-        312, 313, 315, 316, 317, 318, 320, 321, 
-        322, 324, 325, 326, 328, 329, 330, 332, 
-        333, 334, 336, 337, 338, 340, 341, 343, 
-        344, 345, 347, 348, 350, 351, 353, 354, 
-        355, 357, 358, 360, 361, 363, 364, 366, 
-        367, 369, 370, 372, 373, 375, 376, 378, 
-        379, 381, 383, 384, 386, 387, 389, 390, 
-        392, 394, 395, 397, 398, 400, 402, 403, 
-        405, 407, 408, 410, 412, 413, 415, 417, 
-        418, 420, 422, 424, 425, 427, 429, 431
-    },
-    { // Table for +/- 10 semitones
-        144, 144, 145, 146, 146, 147, 148, 148, 
-        149, 150, 150, 151, 152, 152, 153, 154, 
-        154, 155, 156, 157, 157, 158, 159, 159, 
-        160, 161, 162, 162, 163, 164, 165, 165, 
-        166, 167, 168, 168, 169, 170, 171, 171, 
-        172, 173, 174, 175, 175, 176, 177, 178, 
-        179, 179, 180, 181, 182, 183, 183, 184, 
-        185, 186, 187, 188, 189, 189, 190, 191, 
-        192, 193, 194, 195, 196, 196, 197, 198, 
-        199, 200, 201, 202, 203, 204, 205, 205, 
-        206, 207, 208, 209, 210, 211, 212, 213, 
-        214, 215, 216, 217, 218, 219, 220, 221, 
-        222, 223, 224, 225, 226, 227, 228, 229, 
-        230, 231, 232, 233, 234, 235, 236, 238, 
-        239, 240, 241, 242, 243, 244, 245, 246, 
-        247, 249, 250, 251, 252, 253, 254, 255, 
-        257, 258, 259, 260, 261, 262, 264, 265, 
-        266, 267, 268, 270, 271, 272, 273, 275, 
-        276, 277, 278, 280, 281, 282, 283, 285, 
-        286, 287, 289, 290, 291, 293, 294, 295, 
-        297, 298, 299, 301, 302, 303, 305, 306, 
-        308, 309, 310, 312, 313, 315, 316, 317, 
-        319, 320, 322, 323, 325, 326, 328, 329, 
-        331, 332, 334, 335, 337, 338, 340, 341, 
-        343, 344, 346, 348, 349, 351, 352, 354, 
-        356, 357, 359, 360, 362, 364, 365, 367, 
-        369, 370, 372, 374, 375, 377, 379, 381, 
-        382, 384, 386, 387, 389, 391, 393, 395, 
-        396, 398, 400, 402, 404, 405, 407, 409, 
-        411, 413, 415, 417, 418, 420, 422, 424, 
-        426, 428, 430, 432, 434, 436, 438, 440, 
-        442, 444, 446, 448, 450, 452, 454, 456
-    },
-    { // Table for +/- 11 semitones
-        136, 136, 137, 138, 138, 139, 140, 140, 
-        141, 142, 143, 143, 144, 145, 145, 146, 
-        147, 148, 148, 149, 150, 151, 151, 152, 
-        153, 154, 154, 155, 156, 157, 157, 158, 
-        159, 160, 161, 161, 162, 163, 164, 165, 
-        166, 166, 167, 168, 169, 170, 171, 171, 
-        172, 173, 174, 175, 176, 177, 177, 178, 
-        179, 180, 181, 182, 183, 184, 185, 186, 
-        187, 187, 188, 189, 190, 191, 192, 193, 
-        194, 195, 196, 197, 198, 199, 200, 201, 
-        202, 203, 204, 205, 206, 207, 208, 209, 
-        210, 211, 212, 213, 214, 216, 217, 218, 
-        219, 220, 221, 222, 223, 224, 225, 227, 
-        228, 229, 230, 231, 232, 233, 235, 236, 
-        237, 238, 239, 241, 242, 243, 244, 245, 
-        247, 248, 249, 250, 252, 253, 254, 255, 
-        257, 258, 259, 260, 262, 263, 264, 266, 
-        267, 268, 270, 271, 272, 274, 275, 277, 
-        278, 279, 281, 282, 284, 285, 286, 288, 
-        289, 291, 292, 294, 295, 297, 298, 299, 
-        301, 302, 304, 306, 307, 309, 310, 312, 
-        313, 315, 316, 318, 320, 321, 323, 324, 
-        326, 328, 329, 331, 333, 334, 336, 338, 
-        339, 341, 343, 344, 346, 348, 350, 351, 
-        353, 355, 357, 358, 360, 362, 364, 366, 
-        367, 369, 371, 373, 375, 377, 379, 380, 
-        382, 384, 386, 388, 390, 392, 394, 396, 
-        398, 400, 402, 404, 406, 408, 410, 412, 
-        414, 416, 418, 420, 422, 425, 427, 429, 
-        431, 433, 435, 437, 440, 442, 444, 446, 
-        448, 451, 453, 455, 457, 460, 462, 464, 
-        467, 469, 471, 474, 476, 478, 481, 483
-    },
-    { // Table for +/- 12 semitones
-        128, 129, 129, 130, 131, 132, 132, 133, 
-        134, 134, 135, 136, 137, 137, 138, 139, 
-        140, 140, 141, 142, 143, 143, 144, 145, 
-        146, 147, 147, 148, 149, 150, 151, 151, 
-        152, 153, 154, 155, 156, 157, 157, 158, 
-        159, 160, 161, 162, 163, 163, 164, 165, 
-        166, 167, 168, 169, 170, 171, 172, 173, 
-        174, 174, 175, 176, 177, 178, 179, 180, 
-        181, 182, 183, 184, 185, 186, 187, 188, 
-        189, 190, 191, 192, 193, 195, 196, 197, 
-        198, 199, 200, 201, 202, 203, 204, 205, 
-        207, 208, 209, 210, 211, 212, 213, 215, 
-        216, 217, 218, 219, 220, 222, 223, 224, 
-        225, 227, 228, 229, 230, 231, 233, 234, 
-        235, 237, 238, 239, 240, 242, 243, 244, 
-        246, 247, 248, 250, 251, 253, 254, 255, 
-        257, 258, 259, 261, 262, 264, 265, 267, 
-        268, 270, 271, 273, 274, 275, 277, 278, 
-        280, 282, 283, 285, 286, 288, 289, 291, 
-        292, 294, 296, 297, 299, 301, 302, 304, 
-        305, 307, 309, 310, 312, 314, 316, 317, 
-        319, 321, 323, 324, 326, 328, 330, 331, 
-        333, 335, 337, 339, 341, 342, 344, 346, 
-        348, 350, 352, 354, 356, 358, 360, 362, 
-        363, 365, 367, 369, 371, 374, 376, 378, 
-        380, 382, 384, 386, 388, 390, 392, 394, 
-        397, 399, 401, 403, 405, 407, 410, 412, 
-        414, 416, 419, 421, 423, 426, 428, 430, 
-        433, 435, 437, 440, 442, 444, 447, 449, 
-        452, 454, 457, 459, 462, 464, 467, 469, 
-        472, 474, 477, 480, 482, 485, 488, 490, 
-        493, 496, 498, 501, 504, 506, 509, 512
-    },
-    { // Table for +/- 13 semitones
-        121, 122, 122, 123, 124, 124, 125, 126, 
-        127, 127, 128, 129, 130, 130, 131, 132, 
-        133, 134, 134, 135, 136, 137, 138, 138, 
-        139, 140, 141, 142, 142, 143, 144, 145, 
-        146, 147, 148, 148, 149, 150, 151, 152, 
-        153, 154, 155, 156, 157, 157, 158, 159, 
-        160, 161, 162, 163, 164, 165, 166, 167, 
-        168, 169, 170, 171, 172, 173, 174, 175, 
-        176, 177, 178, 179, 180, 181, 182, 184, 
-        185, 186, 187, 188, 189, 190, 191, 192, 
-        194, 195, 196, 197, 198, 199, 200, 202, 
-        203, 204, 205, 206, 208, 209, 210, 211, 
-        213, 214, 215, 216, 218, 219, 220, 222, 
-        223, 224, 226, 227, 228, 230, 231, 232, 
-        234, 235, 236, 238, 239, 241, 242, 243, 
-        245, 246, 248, 249, 251, 252, 254, 255, 
-        257, 258, 260, 261, 263, 264, 266, 268, 
-        269, 271, 272, 274, 276, 277, 279, 280, 
-        282, 284, 285, 287, 289, 291, 292, 294, 
-        296, 297, 299, 301, 303, 305, 306, 308, 
-        310, 312, 314, 316, 317, 319, 321, 323, 
-        325, 327, 329, 331, 333, 335, 337, 339, 
-        341, 343, 345, 347, 349, 351, 353, 355, 
-        357, 359, 361, 363, 366, 368, 370, 372, 
-        374, 376, 379, 381, 383, 385, 388, 390, 
-        392, 395, 397, 399, 402, 404, 406, 409, 
-        411, 414, 416, 419, 421, 424, 426, 429, 
-        431, 434, 436, 439, 441, 444, 447, 449, 
-        452, 455, 457, 460, 463, 465, 468, 471, 
-        474, 476, 479, 482, 485, 488, 491, 494, 
-        497, 499, 502, 505, 508, 511, 514, 517, 
-        520, 524, 527, 530, 533, 536, 539, 542
-    },
-    { // Table for +/- 14 semitones
-        114, 115, 115, 116, 117, 118, 118, 119, 
-        120, 121, 122, 122, 123, 124, 125, 125, 
-        126, 127, 128, 129, 129, 130, 131, 132, 
-        133, 134, 134, 135, 136, 137, 138, 139, 
-        140, 141, 141, 142, 143, 144, 145, 146, 
-        147, 148, 149, 150, 151, 152, 153, 154, 
-        155, 156, 157, 158, 159, 160, 161, 162, 
-        163, 164, 165, 166, 167, 168, 169, 170, 
-        171, 172, 173, 174, 176, 177, 178, 179, 
-        180, 181, 182, 183, 185, 186, 187, 188, 
-        189, 191, 192, 193, 194, 196, 197, 198, 
-        199, 201, 202, 203, 204, 206, 207, 208, 
-        210, 211, 212, 214, 215, 216, 218, 219, 
-        221, 222, 223, 225, 226, 228, 229, 231, 
-        232, 233, 235, 236, 238, 239, 241, 243, 
-        244, 246, 247, 249, 250, 252, 254, 255, 
-        257, 258, 260, 262, 263, 265, 267, 268, 
-        270, 272, 274, 275, 277, 279, 281, 282, 
-        284, 286, 288, 290, 292, 293, 295, 297, 
-        299, 301, 303, 305, 307, 309, 311, 313, 
-        315, 317, 319, 321, 323, 325, 327, 329, 
-        331, 333, 335, 337, 339, 342, 344, 346, 
-        348, 350, 353, 355, 357, 359, 362, 364, 
-        366, 369, 371, 373, 376, 378, 381, 383, 
-        385, 388, 390, 393, 395, 398, 400, 403, 
-        405, 408, 411, 413, 416, 418, 421, 424, 
-        427, 429, 432, 435, 437, 440, 443, 446, 
-        449, 452, 454, 457, 460, 463, 466, 469, 
-        472, 475, 478, 481, 484, 487, 490, 494, 
-        497, 500, 503, 506, 509, 513, 516, 519, 
-        522, 526, 529, 533, 536, 539, 543, 546, 
-        550, 553, 557, 560, 564, 567, 571, 575
-    },
-    { // Table for +/- 15 semitones
-        108, 108, 109, 110, 111, 111, 112, 113, 
-        114, 114, 115, 116, 117, 118, 118, 119, 
-        120, 121, 122, 122, 123, 124, 125, 126, 
-        127, 128, 128, 129, 130, 131, 132, 133, 
-        134, 135, 136, 137, 137, 138, 139, 140, 
-        141, 142, 143, 144, 145, 146, 147, 148, 
-        149, 150, 151, 152, 153, 154, 155, 156, 
-        157, 159, 160, 161, 162, 163, 164, 165, 
-        166, 167, 169, 170, 171, 172, 173, 174, 
-        176, 177, 178, 179, 180, 182, 183, 184, 
-        185, 187, 188, 189, 190, 192, 193, 194, 
-        196, 197, 198, 200, 201, 202, 204, 205, 
-        207, 208, 209, 211, 212, 214, 215, 217, 
-        218, 220, 221, 223, 224, 226, 227, 229, 
-        230, 232, 234, 235, 237, 238, 240, 242, 
-        243, 245, 247, 248, 250, 252, 253, 255, 
-        257, 259, 260, 262, 264, 266, 268, 269, 
-        271, 273, 275, 277, 279, 281, 282, 284, 
-        286, 288, 290, 292, 294, 296, 298, 300, 
-        302, 304, 306, 309, 311, 313, 315, 317, 
-        319, 321, 324, 326, 328, 330, 333, 335, 
-        337, 339, 342, 344, 346, 349, 351, 354, 
-        356, 358, 361, 363, 366, 368, 371, 373, 
-        376, 378, 381, 384, 386, 389, 391, 394, 
-        397, 399, 402, 405, 408, 411, 413, 416, 
-        419, 422, 425, 428, 431, 433, 436, 439, 
-        442, 445, 448, 451, 455, 458, 461, 464, 
-        467, 470, 473, 477, 480, 483, 487, 490, 
-        493, 497, 500, 503, 507, 510, 514, 517, 
-        521, 524, 528, 531, 535, 539, 542, 546, 
-        550, 554, 557, 561, 565, 569, 573, 577, 
-        581, 584, 588, 592, 597, 601, 605, 609
-    },
-    { // Table for +/- 16 semitones
-        102, 102, 103, 104, 105, 105, 106, 107, 
-        108, 108, 109, 110, 111, 112, 112, 113, 
-        114, 115, 116, 117, 117, 118, 119, 120, 
-        121, 122, 123, 124, 124, 125, 126, 127, 
-        128, 129, 130, 131, 132, 133, 134, 135, 
-        136, 137, 138, 139, 140, 141, 142, 143, 
-        144, 145, 146, 147, 148, 149, 150, 151, 
-        152, 154, 155, 156, 157, 158, 159, 160, 
-        162, 163, 164, 165, 166, 168, 169, 170, 
-        171, 172, 174, 175, 176, 178, 179, 180, 
-        181, 183, 184, 185, 187, 188, 189, 191, 
-        192, 194, 195, 196, 198, 199, 201, 202, 
-        204, 205, 207, 208, 210, 211, 213, 214, 
-        216, 217, 219, 221, 222, 224, 225, 227, 
-        229, 230, 232, 234, 236, 237, 239, 241, 
-        242, 244, 246, 248, 250, 251, 253, 255, 
-        257, 259, 261, 263, 264, 266, 268, 270, 
-        272, 274, 276, 278, 280, 282, 284, 286, 
-        289, 291, 293, 295, 297, 299, 301, 304, 
-        306, 308, 310, 312, 315, 317, 319, 322, 
-        324, 326, 329, 331, 334, 336, 338, 341, 
-        343, 346, 348, 351, 353, 356, 359, 361, 
-        364, 366, 369, 372, 375, 377, 380, 383, 
-        386, 388, 391, 394, 397, 400, 403, 406, 
-        409, 412, 415, 418, 421, 424, 427, 430, 
-        433, 436, 439, 442, 446, 449, 452, 455, 
-        459, 462, 465, 469, 472, 476, 479, 483, 
-        486, 490, 493, 497, 500, 504, 508, 511, 
-        515, 519, 523, 527, 530, 534, 538, 542, 
-        546, 550, 554, 558, 562, 566, 570, 574, 
-        579, 583, 587, 591, 596, 600, 604, 609, 
-        613, 618, 622, 627, 631, 636, 640, 645
-    },
-    { // Table for +/- 17 semitones
-        96, 97, 97, 98, 99, 100, 100, 101, 
-        102, 103, 104, 104, 105, 106, 107, 108, 
-        108, 109, 110, 111, 112, 113, 114, 114, 
-        115, 116, 117, 118, 119, 120, 121, 122, 
-        123, 124, 125, 126, 127, 128, 128, 129, 
-        130, 131, 133, 134, 135, 136, 137, 138, 
-        139, 140, 141, 142, 143, 144, 145, 146, 
-        148, 149, 150, 151, 152, 153, 155, 156, 
-        157, 158, 159, 161, 162, 163, 164, 166, 
-        167, 168, 170, 171, 172, 174, 175, 176, 
-        178, 179, 180, 182, 183, 185, 186, 187, 
-        189, 190, 192, 193, 195, 196, 198, 199, 
-        201, 202, 204, 206, 207, 209, 210, 212, 
-        214, 215, 217, 219, 220, 222, 224, 225, 
-        227, 229, 231, 232, 234, 236, 238, 240, 
-        242, 243, 245, 247, 249, 251, 253, 255, 
-        257, 259, 261, 263, 265, 267, 269, 271, 
-        273, 275, 278, 280, 282, 284, 286, 288, 
-        291, 293, 295, 297, 300, 302, 304, 307, 
-        309, 312, 314, 316, 319, 321, 324, 326, 
-        329, 331, 334, 336, 339, 342, 344, 347, 
-        350, 352, 355, 358, 361, 363, 366, 369, 
-        372, 375, 378, 381, 384, 386, 389, 392, 
-        396, 399, 402, 405, 408, 411, 414, 417, 
-        421, 424, 427, 430, 434, 437, 441, 444, 
-        447, 451, 454, 458, 461, 465, 469, 472, 
-        476, 480, 483, 487, 491, 495, 498, 502, 
-        506, 510, 514, 518, 522, 526, 530, 534, 
-        538, 542, 547, 551, 555, 559, 564, 568, 
-        572, 577, 581, 586, 590, 595, 600, 604, 
-        609, 614, 618, 623, 628, 633, 638, 643, 
-        647, 652, 658, 663, 668, 673, 678, 683
-    },
-    { // Table for +/- 18 semitones
-        91, 91, 92, 93, 94, 94, 95, 96, 
-        97, 97, 98, 99, 100, 101, 101, 102, 
-        103, 104, 105, 106, 107, 107, 108, 109, 
-        110, 111, 112, 113, 114, 115, 116, 117, 
-        117, 118, 119, 120, 121, 122, 123, 124, 
-        125, 126, 127, 129, 130, 131, 132, 133, 
-        134, 135, 136, 137, 138, 139, 141, 142, 
-        143, 144, 145, 146, 148, 149, 150, 151, 
-        153, 154, 155, 156, 158, 159, 160, 161, 
-        163, 164, 165, 167, 168, 170, 171, 172, 
-        174, 175, 177, 178, 180, 181, 182, 184, 
-        185, 187, 189, 190, 192, 193, 195, 196, 
-        198, 200, 201, 203, 205, 206, 208, 210, 
-        211, 213, 215, 217, 218, 220, 222, 224, 
-        226, 227, 229, 231, 233, 235, 237, 239, 
-        241, 243, 245, 247, 249, 251, 253, 255, 
-        257, 259, 261, 263, 266, 268, 270, 272, 
-        274, 277, 279, 281, 283, 286, 288, 290, 
-        293, 295, 298, 300, 303, 305, 308, 310, 
-        313, 315, 318, 320, 323, 326, 328, 331, 
-        334, 336, 339, 342, 345, 348, 350, 353, 
-        356, 359, 362, 365, 368, 371, 374, 377, 
-        380, 383, 386, 390, 393, 396, 399, 402, 
-        406, 409, 412, 416, 419, 423, 426, 430, 
-        433, 437, 440, 444, 447, 451, 455, 459, 
-        462, 466, 470, 474, 478, 482, 486, 489, 
-        494, 498, 502, 506, 510, 514, 518, 522, 
-        527, 531, 535, 540, 544, 549, 553, 558, 
-        562, 567, 572, 576, 581, 586, 590, 595, 
-        600, 605, 610, 615, 620, 625, 630, 635, 
-        641, 646, 651, 656, 662, 667, 673, 678, 
-        684, 689, 695, 701, 706, 712, 718, 724
-    },
-    { // Table for +/- 19 semitones
-        85, 86, 87, 88, 88, 89, 90, 91, 
-        92, 92, 93, 94, 95, 96, 96, 97, 
-        98, 99, 100, 101, 101, 102, 103, 104, 
-        105, 106, 107, 108, 109, 110, 111, 112, 
-        113, 113, 114, 115, 116, 117, 118, 120, 
-        121, 122, 123, 124, 125, 126, 127, 128, 
-        129, 130, 131, 133, 134, 135, 136, 137, 
-        138, 140, 141, 142, 143, 144, 146, 147, 
-        148, 149, 151, 152, 153, 155, 156, 157, 
-        159, 160, 162, 163, 164, 166, 167, 169, 
-        170, 172, 173, 175, 176, 178, 179, 181, 
-        182, 184, 185, 187, 189, 190, 192, 194, 
-        195, 197, 199, 200, 202, 204, 206, 207, 
-        209, 211, 213, 215, 216, 218, 220, 222, 
-        224, 226, 228, 230, 232, 234, 236, 238, 
-        240, 242, 244, 246, 248, 251, 253, 255, 
-        257, 259, 262, 264, 266, 268, 271, 273, 
-        275, 278, 280, 283, 285, 288, 290, 293, 
-        295, 298, 300, 303, 305, 308, 311, 313, 
-        316, 319, 322, 324, 327, 330, 333, 336, 
-        339, 342, 344, 347, 350, 353, 357, 360, 
-        363, 366, 369, 372, 375, 379, 382, 385, 
-        389, 392, 395, 399, 402, 406, 409, 413, 
-        416, 420, 424, 427, 431, 435, 438, 442, 
-        446, 450, 454, 458, 462, 466, 470, 474, 
-        478, 482, 486, 490, 495, 499, 503, 507, 
-        512, 516, 521, 525, 530, 534, 539, 544, 
-        548, 553, 558, 563, 568, 572, 577, 582, 
-        587, 592, 598, 603, 608, 613, 619, 624, 
-        629, 635, 640, 646, 651, 657, 663, 668, 
-        674, 680, 686, 692, 698, 704, 710, 716, 
-        722, 728, 735, 741, 747, 754, 760, 767
-    },
-    { // Table for +/- 20 semitones
-        81, 81, 82, 83, 84, 84, 85, 86, 
-        87, 87, 88, 89, 90, 91, 92, 92, 
-        93, 94, 95, 96, 97, 98, 98, 99, 
-        100, 101, 102, 103, 104, 105, 106, 107, 
-        108, 109, 110, 111, 112, 113, 114, 115, 
-        116, 117, 118, 119, 120, 121, 122, 123, 
-        125, 126, 127, 128, 129, 130, 132, 133, 
-        134, 135, 136, 138, 139, 140, 141, 143, 
-        144, 145, 147, 148, 149, 151, 152, 153, 
-        155, 156, 158, 159, 161, 162, 163, 165, 
-        166, 168, 170, 171, 173, 174, 176, 177, 
-        179, 181, 182, 184, 186, 187, 189, 191, 
-        192, 194, 196, 198, 200, 201, 203, 205, 
-        207, 209, 211, 213, 215, 216, 218, 220, 
-        222, 224, 227, 229, 231, 233, 235, 237, 
-        239, 241, 244, 246, 248, 250, 253, 255, 
-        257, 259, 262, 264, 267, 269, 272, 274, 
-        276, 279, 282, 284, 287, 289, 292, 295, 
-        297, 300, 303, 305, 308, 311, 314, 317, 
-        320, 323, 325, 328, 331, 334, 337, 341, 
-        344, 347, 350, 353, 356, 360, 363, 366, 
-        369, 373, 376, 380, 383, 387, 390, 394, 
-        397, 401, 404, 408, 412, 416, 419, 423, 
-        427, 431, 435, 439, 443, 447, 451, 455, 
-        459, 463, 468, 472, 476, 480, 485, 489, 
-        494, 498, 503, 507, 512, 517, 521, 526, 
-        531, 536, 541, 545, 550, 555, 560, 566, 
-        571, 576, 581, 586, 592, 597, 603, 608, 
-        614, 619, 625, 631, 636, 642, 648, 654, 
-        660, 666, 672, 678, 684, 690, 697, 703, 
-        709, 716, 722, 729, 736, 742, 749, 756, 
-        763, 770, 777, 784, 791, 798, 805, 813
-    },
-    { // Table for +/- 21 semitones
-        76, 77, 78, 78, 79, 80, 81, 81, 
-        82, 83, 84, 85, 85, 86, 87, 88, 
-        89, 89, 90, 91, 92, 93, 94, 95, 
-        96, 97, 97, 98, 99, 100, 101, 102, 
-        103, 104, 105, 106, 107, 108, 109, 110, 
-        111, 112, 113, 115, 116, 117, 118, 119, 
-        120, 121, 122, 124, 125, 126, 127, 128, 
-        130, 131, 132, 133, 135, 136, 137, 139, 
-        140, 141, 143, 144, 145, 147, 148, 150, 
-        151, 152, 154, 155, 157, 158, 160, 161, 
-        163, 164, 166, 168, 169, 171, 172, 174, 
-        176, 177, 179, 181, 183, 184, 186, 188, 
-        190, 192, 193, 195, 197, 199, 201, 203, 
-        205, 207, 209, 211, 213, 215, 217, 219, 
-        221, 223, 225, 227, 229, 232, 234, 236, 
-        238, 241, 243, 245, 248, 250, 252, 255, 
-        257, 260, 262, 265, 267, 270, 272, 275, 
-        278, 280, 283, 286, 288, 291, 294, 297, 
-        299, 302, 305, 308, 311, 314, 317, 320, 
-        323, 326, 329, 333, 336, 339, 342, 345, 
-        349, 352, 355, 359, 362, 366, 369, 373, 
-        376, 380, 384, 387, 391, 395, 398, 402, 
-        406, 410, 414, 418, 422, 426, 430, 434, 
-        438, 442, 447, 451, 455, 460, 464, 468, 
-        473, 477, 482, 487, 491, 496, 501, 505, 
-        510, 515, 520, 525, 530, 535, 540, 545, 
-        551, 556, 561, 566, 572, 577, 583, 588, 
-        594, 600, 605, 611, 617, 623, 629, 635, 
-        641, 647, 653, 660, 666, 672, 679, 685, 
-        692, 698, 705, 712, 719, 725, 732, 739, 
-        746, 754, 761, 768, 775, 783, 790, 798, 
-        805, 813, 821, 829, 837, 845, 853, 861
-    },
-    { // Table for +/- 22 semitones
-        72, 73, 73, 74, 75, 76, 76, 77, 
-        78, 79, 79, 80, 81, 82, 83, 83, 
-        84, 85, 86, 87, 88, 89, 89, 90, 
-        91, 92, 93, 94, 95, 96, 97, 98, 
-        99, 100, 101, 102, 103, 104, 105, 106, 
-        107, 108, 109, 110, 111, 112, 114, 115, 
-        116, 117, 118, 119, 121, 122, 123, 124, 
-        126, 127, 128, 129, 131, 132, 133, 135, 
-        136, 137, 139, 140, 141, 143, 144, 146, 
-        147, 149, 150, 152, 153, 155, 156, 158, 
-        159, 161, 163, 164, 166, 168, 169, 171, 
-        173, 174, 176, 178, 180, 182, 183, 185, 
-        187, 189, 191, 193, 195, 197, 199, 201, 
-        203, 205, 207, 209, 211, 213, 215, 217, 
-        219, 222, 224, 226, 228, 231, 233, 235, 
-        238, 240, 242, 245, 247, 250, 252, 255, 
-        257, 260, 262, 265, 268, 270, 273, 276, 
-        279, 281, 284, 287, 290, 293, 296, 299, 
-        302, 305, 308, 311, 314, 317, 320, 324, 
-        327, 330, 333, 337, 340, 343, 347, 350, 
-        354, 357, 361, 365, 368, 372, 376, 379, 
-        383, 387, 391, 395, 399, 403, 407, 411, 
-        415, 419, 423, 428, 432, 436, 441, 445, 
-        450, 454, 459, 463, 468, 472, 477, 482, 
-        487, 492, 497, 502, 507, 512, 517, 522, 
-        527, 533, 538, 543, 549, 554, 560, 565, 
-        571, 577, 582, 588, 594, 600, 606, 612, 
-        618, 625, 631, 637, 644, 650, 656, 663, 
-        670, 676, 683, 690, 697, 704, 711, 718, 
-        725, 733, 740, 747, 755, 762, 770, 778, 
-        785, 793, 801, 809, 817, 826, 834, 842, 
-        851, 859, 868, 876, 885, 894, 903, 912
-    },
-    { // Table for +/- 23 semitones
-        68, 69, 69, 70, 71, 71, 72, 73, 
-        74, 74, 75, 76, 77, 78, 78, 79, 
-        80, 81, 82, 83, 84, 84, 85, 86, 
-        87, 88, 89, 90, 91, 92, 93, 94, 
-        95, 96, 97, 98, 99, 100, 101, 102, 
-        103, 104, 105, 106, 107, 108, 110, 111, 
-        112, 113, 114, 115, 117, 118, 119, 120, 
-        122, 123, 124, 125, 127, 128, 129, 131, 
-        132, 133, 135, 136, 138, 139, 141, 142, 
-        144, 145, 147, 148, 150, 151, 153, 154, 
-        156, 158, 159, 161, 163, 164, 166, 168, 
-        170, 171, 173, 175, 177, 179, 181, 182, 
-        184, 186, 188, 190, 192, 194, 196, 198, 
-        200, 202, 205, 207, 209, 211, 213, 216, 
-        218, 220, 222, 225, 227, 229, 232, 234, 
-        237, 239, 242, 244, 247, 249, 252, 255, 
-        257, 260, 263, 265, 268, 271, 274, 277, 
-        280, 283, 286, 289, 292, 295, 298, 301, 
-        304, 307, 310, 314, 317, 320, 324, 327, 
-        330, 334, 337, 341, 344, 348, 352, 355, 
-        359, 363, 367, 371, 374, 378, 382, 386, 
-        390, 394, 399, 403, 407, 411, 416, 420, 
-        424, 429, 433, 438, 442, 447, 452, 456, 
-        461, 466, 471, 476, 481, 486, 491, 496, 
-        501, 507, 512, 517, 523, 528, 534, 539, 
-        545, 551, 556, 562, 568, 574, 580, 586, 
-        592, 598, 605, 611, 617, 624, 630, 637, 
-        644, 650, 657, 664, 671, 678, 685, 692, 
-        700, 707, 714, 722, 729, 737, 745, 753, 
-        760, 768, 776, 785, 793, 801, 810, 818, 
-        827, 835, 844, 853, 862, 871, 880, 889, 
-        898, 908, 917, 927, 937, 946, 956, 966
-    },
-    { // Table for +/- 24 semitones
-        64, 65, 65, 66, 67, 68, 68, 69, 
-        70, 71, 71, 72, 73, 74, 75, 75, 
-        76, 77, 78, 79, 80, 80, 81, 82, 
-        83, 84, 85, 86, 87, 88, 89, 90, 
-        91, 92, 93, 94, 95, 96, 97, 98, 
-        99, 100, 101, 102, 103, 104, 106, 107, 
-        108, 109, 110, 111, 113, 114, 115, 116, 
-        118, 119, 120, 122, 123, 124, 126, 127, 
-        128, 130, 131, 133, 134, 136, 137, 138, 
-        140, 142, 143, 145, 146, 148, 149, 151, 
-        153, 154, 156, 158, 160, 161, 163, 165, 
-        167, 168, 170, 172, 174, 176, 178, 180, 
-        182, 184, 186, 188, 190, 192, 194, 196, 
-        198, 200, 203, 205, 207, 209, 212, 214, 
-        216, 219, 221, 223, 226, 228, 231, 233, 
-        236, 239, 241, 244, 246, 249, 252, 255, 
-        257, 260, 263, 266, 269, 272, 275, 278, 
-        281, 284, 287, 290, 293, 296, 300, 303, 
-        306, 310, 313, 316, 320, 323, 327, 330, 
-        334, 338, 341, 345, 349, 353, 357, 361, 
-        364, 368, 372, 377, 381, 385, 389, 393, 
-        398, 402, 406, 411, 415, 420, 424, 429, 
-        434, 438, 443, 448, 453, 458, 463, 468, 
-        473, 478, 484, 489, 494, 500, 505, 511, 
-        516, 522, 527, 533, 539, 545, 551, 557, 
-        563, 569, 575, 582, 588, 594, 601, 608, 
-        614, 621, 628, 635, 641, 649, 656, 663, 
-        670, 677, 685, 692, 700, 707, 715, 723, 
-        731, 739, 747, 755, 763, 772, 780, 789, 
-        797, 806, 815, 824, 833, 842, 851, 860, 
-        870, 879, 889, 899, 908, 918, 928, 939, 
-        949, 959, 970, 980, 991, 1002, 1013, 1024
-    }
-};
-
-#endif // PITCH_BEND_TABLE_INTERPOLATED_H
@@ -0,0 +1,137 @@
+#include "render_split.h"
+
+volatile bool render_split_enabled = true;
+
+// Work handed to core0 and the buffer it renders into
+static voice_mask_t helper_voices;
+static size_t helper_frames;
+static stereo_t helper_buffer[MAX_RENDER_BLOCK_FRAMES];
+
+static void render_helper()
+{
+    for (size_t n = 0; n < helper_frames; n++)
+    {
+        helper_buffer[n].u32 = 0;
+    }
+    mix_voices(voice_state, helper_voices, helper_buffer, helper_frames);
+}
+
+// Split the active voices so both cores get about the same measured cost, the audio core starting
+// with the cost of the work it always does itself (the drums). Voices are placed from the most to the
+// least expensive, each on the core with less work so far, so a costly voice found late cannot leave
+// one core far behind. Returns the voices for core0.
+voice_mask_t render_split_partition(voice_mask_t active, uint32_t audio_core_cost)
+{
+    // Active voices by cost, highest first (insertion sort, there are at most MAX_VOICE_NUM)
+    int8_t order[MAX_VOICE_NUM];
+    int count = 0;
+    while (active != 0)
+    {
+        int i = VOICE_MASK_FIRST(active);
+        active &= active - 1;
+        int n = count++;
+        while (n > 0 && voice_state[order[n - 1]].cost < voice_state[i].cost)
+        {
+            order[n] = order[n - 1];
+            n--;
+        }
+        order[n] = (int8_t)i;
+    }
+
+    uint32_t cost[2] = {0, audio_core_cost};
+    voice_mask_t helper = 0;
+    for (int n = 0; n < count; n++)
+    {
+        int i = order[n];
+        uint32_t voice_cost = voice_state[i].cost + 1; // Never zero, so unmeasured voices still alternate
+        if (cost[0] <= cost[1])
+        {
+            helper |= VOICE_MASK_BIT(i);
+            cost[0] += voice_cost;
+        }
+        else
+        {
+            cost[1] += voice_cost;
+        }
+    }
+    return helper;
+}
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#include "pico/multicore.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+#if PICO_RP2040
+#define RENDER_SPLIT_IRQ SIO_IRQ_PROC0
+#else
+#define RENDER_SPLIT_IRQ SIO_IRQ_FIFO // RP2350: each core gets the interrupt of its own receive FIFO
+#endif
+
+// Core0: a word in the FIFO asks for the voices in helper_voices, the reply says the buffer is ready
+static void render_split_irq_handler()
+{
+    while (multicore_fifo_rvalid())
+    {
+        multicore_fifo_pop_blocking();
+        __dmb(); // See the voice state core1 wrote before asking
+        render_helper();
+        __dmb(); // Buffer and voice state are complete before the reply
+        multicore_fifo_push_blocking(0);
+    }
+    multicore_fifo_clear_irq();
+}
+
+// Start the cycle counter used to measure the voices, on the calling core
+void render_split_init_core()
+{
+    systick_hw->rvr = 0xffffff;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // Enabled, counting processor clock cycles
+}
+
+// Core0, after core1 has been launched
+void render_split_init()
+{
+    render_split_init_core();
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(RENDER_SPLIT_IRQ, render_split_irq_handler);
+    irq_set_priority(RENDER_SPLIT_IRQ, PICO_LOWEST_IRQ_PRIORITY); // USB interrupts still get through
+    irq_set_enabled(RENDER_SPLIT_IRQ, true);
+}
+
+void render_split_start(voice_mask_t voices, size_t frames)
+{
+    helper_voices = voices;
+    helper_frames = frames;
+    __dmb();
+    multicore_fifo_push_blocking(0);
+}
+
+const stereo_t *render_split_finish()
+{
+    multicore_fifo_pop_blocking();
+    __dmb();
+    return helper_buffer;
+}
+#else
+void render_split_init_core()
+{
+}
+
+void render_split_init()
+{
+}
+
+void render_split_start(voice_mask_t voices, size_t frames)
+{
+    helper_voices = voices;
+    helper_frames = frames;
+}
+
+const stereo_t *render_split_finish()
+{
+    render_helper();
+    return helper_buffer;
+}
+#endif
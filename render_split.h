@@ -0,0 +1,59 @@
+#ifndef RENDER_SPLIT_H
+#define RENDER_SPLIT_H
+
+#include "synthesizer.h"
+
+// Voice rendering shared between the two cores. For every span it renders, the audio core (core1)
+// hands a set of voices to core0 through the inter-core FIFO, renders the other voices and the drums
+// itself, and adds core0's buffer before the reverb and DC cut. Core0 renders its share from the
+// FIFO interrupt, pausing the USB and MIDI input work for that long.
+// Voices are split by their measured render cost so that both cores finish at about the same time.
+// Outside the device the share of core0 is rendered in place, with the same results.
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#include "hardware/structs/systick.h"
+#include "pico/platform.h"
+
+// Core the caller runs on, selects its measurement tables
+static inline int render_core()
+{
+    return (int)get_core_num();
+}
+
+// Processor cycles from the core's own SysTick, a 24-bit down counter started by render_split_init_core()
+static inline uint32_t render_cycles()
+{
+    return systick_hw->cvr;
+}
+
+static inline uint32_t render_cycles_since(uint32_t start)
+{
+    return (start - systick_hw->cvr) & 0xffffff;
+}
+#else
+static inline int render_core()
+{
+    return 0;
+}
+
+static inline uint32_t render_cycles()
+{
+    return 0;
+}
+
+static inline uint32_t render_cycles_since(uint32_t start)
+{
+    (void)start;
+    return 0;
+}
+#endif
+
+extern volatile bool render_split_enabled; // Clear to render everything on the audio core
+
+void render_split_init_core();
+void render_split_init();
+voice_mask_t render_split_partition(voice_mask_t active, uint32_t audio_core_cost);
+void render_split_start(voice_mask_t voices, size_t frames);
+const stereo_t *render_split_finish();
+
+#endif // RENDER_SPLIT_H
@@ -10,22 +10,26 @@ Synthesizer
 │    │    │    ├─ osc1 (wave_type_t type)
 │    │    │    ├─ rm (int8_t freq_rate, int8_t rm_gain)
 │    │    │    ├─ sweep (sweep_type_t type, int8_t speed)
-│    │    │    ├─ env (int8_t attack_time, decay_time, sustain_level, sustain_rate, release_time)
+│    │    │    ├─ env (int8_t attack_time, decay_time, sustain_level, sustain_rate, release_time, curve)
 │    │    │    └─ output_gain (fp_t)
 │    │    ├─ voice_state_t
 │    │    │    ├─ assigned_channel_num (int8_t)
 │    │    │    ├─ tone (tone_t)
 │    │    │    ├─ note (int8_t)
 │    │    │    ├─ velocity (int8_t)
-│    │    │    ├─ osc1 (wave_type_t type, q8_t increment, q8_t read_pointer)
-│    │    │    ├─ osc2 (q8_t increment, q8_t read_pointer)
-│    │    │    ├─ pb (q8_t factor)
-│    │    │    ├─ env (fp_t amplitude, env_state_t state, uint32_t counter, bool is_note_off_received)
+│    │    │    ├─ osc1 (wave_type_t type, const fp_t *table, phase_t increment, phase_t read_pointer, phase_t effective_increment, int32_t increment_slope, uint32_t noise_state)
+│    │    │    ├─ osc2 (phase_t increment, phase_t read_pointer, phase_t effective_increment, int32_t increment_slope)
+│    │    │    ├─ env (level/target/slope/countdown, precomputed rates, env_state_t state, bool is_note_off_received)
 │    │    │    ├─ dc_cut (fp_t prev_out, fp_t prev_in)
-│    │    │    └─ amplitude (fp_t)
+│    │    │    ├─ amplitude (fp_t)
+│    │    │    ├─ kernel (voice_kernel_t)
+│    │    │    ├─ kernel_index (uint8_t)
+│    │    │    └─ cost (uint16_t)
 │    │    └─ ch_state_t
 │    │         ├─ tone (tone_t)
-│    │         ├─ pitch_bend (int8_t sensitivity, uint16_t range)
+│    │         ├─ pitch_bend (uint16_t sensitivity, uint16_t range)
+│    │         ├─ tuning (int16_t fine, int8_t coarse)
+│    │         ├─ pitch_offset (pitch_t)
 │    │         ├─ volume (fp_t)
 │    │         ├─ expression (uint8_t)
 │    │         ├─ mod (uint8_t depth, uint8_t freq)
@@ -40,100 +44,244 @@ Synthesizer
 │    │    └─ reverb_state_t reverb_state
 │    └─ function declarations
 │         ├─ set_voice_state
-│         ├─ voice
 │         ├─ init_channel
+│         ├─ init_voices
+│         ├─ init_envelope_tables
 │         ├─ init_master
 │         ├─ init_reverb
 │         ├─ note_on
 │         ├─ note_off
-│         ├─ channel
-│         ├─ reverb
-│         ├─ master
-│         └─ synthesizer_task
+│         ├─ mix_voices
+│         ├─ reverb_block
+│         ├─ render_block
+│         ├─ render_block_unscheduled
+│         └─ synthesizer_reset_clock
 │
 ├─ tone.c (tone_gm definition)
 │
-├─ pitch_bend_table.h (pitch_bend_factors_all definition)
+├─ wave_table.h (sin_quarter_table and pitch table definitions)
 │
-├─ wave_table.h (wave_table definitions)
+├─ voice_alloc.h / voice_alloc.c (free voices, steal order and (channel, note) lookup)
+│
+├─ drum.h / drum.c (PCM drum pool for the drum channel with choke groups)
+│
+├─ render_split.h / render_split.c (voice rendering shared with core0, cost based partition)
+│
+├─ oscillator.h / oscillator.c (waveform generators, wave tables, pitch to increment and interpolator setup)
 │
 ├─ fp.h (fixed-point arithmetic definitions)
 │
-├─ midi.h (MIDI buffer and event handling)
+├─ midi.h (lock-free MIDI event ring and event handling)
+│
+├─ midi_parser.h / midi_parser.c (MIDI 1.0 byte stream parser for DIN input)
+│
+├─ midi_uart.h / midi_uart.c (DIN MIDI input on a UART with an RX DMA ring)
 │
 ├─ synthesizer.c
 │    ├─ global variables definitions
 │    │    ├─ voice_state_t voice_state[MAX_VOICE_NUM]
 │    │    ├─ ch_state_t channel_state[MAX_CHANNEL_NUM]
 │    │    ├─ master_state_t master_state
-│    │    └─ reverb_state_t reverb_state
+│    │    ├─ reverb_state_t reverb_state
+│    │    └─ voice_mask_t channel_voice_mask[MAX_CHANNEL_NUM]
 │    ├─ function definitions
 │    │    ├─ set_voice_state(voice_state_t *vs, tone_t *tone, int8_t ch, int8_t note, int8_t velocity)
-│    │    ├─ voice(voice_state_t *vs)
 │    │    ├─ init_channel(int8_t ch_to_init)
+│    │    ├─ init_voices()
+│    │    ├─ init_envelope_tables()
 │    │    ├─ init_master()
 │    │    ├─ init_reverb()
 │    │    ├─ note_on(midi_t *midi, voice_state_t *vs)
 │    │    ├─ note_off(midi_t *midi, voice_state_t *vs)
-│    │    ├─ channel(voice_state_t *vs, int8_t ch)
-│    │    ├─ reverb(stereo_t input)
-│    │    ├─ master(voice_state_t *vs)
-│    │    └─ synthesizer_task()
+│    │    ├─ mix_voices(voice_state_t *vs, voice_mask_t voices, stereo_t *out, size_t frames)
+│    │    ├─ reverb_block(stereo_t *buffer, size_t frames)
+│    │    ├─ render_block(stereo_t *out, size_t frames)
+│    │    ├─ render_block_unscheduled(stereo_t *out, size_t frames)
+│    │    └─ synthesizer_reset_clock()
 */
 
 #include "synthesizer.h"
 #include "pan_table.h"
+#include "voice_alloc.h"
+#include "drum.h"
+#include "render_split.h"
 
 voice_state_t voice_state[MAX_VOICE_NUM];
 ch_state_t channel_state[MAX_CHANNEL_NUM];
 master_state_t master_state;
 reverb_state_t reverb_state;
+voice_mask_t channel_voice_mask[MAX_CHANNEL_NUM];
+static uint32_t render_frame; // Frames rendered so far, the clock MIDI events are scheduled on
+static uint16_t kernel_cost[8]; // Last measured cost of each kernel, the first guess for a new voice
+// Each core measures into its own table while mixing, master_block() merges them when both are done
+static uint16_t core_kernel_cost[2][8];
+static uint8_t core_kernel_measured[2]; // Kernels measured in this span, a bit per kernel index
+#if RENDER_SPLIT
+static uint32_t drum_cost; // Measured drum rendering cycles per frame
+#endif
+
+// Envelope steps per control period for each time parameter, built from FS by init_envelope_tables()
+static int32_t env_linear_step_table[128];  // Linear segments: level change per control period
+static int32_t env_exp_coef_table[128];     // Exponential segments: Q30 decay factor per control period
+static int32_t env_sustain_step_unit;       // Sustain: level change per control period for a sustain rate of 1
+
+static void voice_select_kernel(voice_state_t *vs);
+static size_t synthesizer_apply_events(size_t frames, uint32_t start);
+
+// Put a voice on the active list of its channel
+static inline void voice_activate(voice_state_t *vs, int8_t ch)
+{
+    voice_mask_t bit = VOICE_MASK_BIT(vs - voice_state);
+    channel_voice_mask[vs->assigned_channel_num] &= ~bit;
+    channel_voice_mask[ch] |= bit;
+}
 
-static inline q8_t get_interpolated_pitch_bend_factor(int8_t sensitivity_idx, uint16_t bend_value_midi)
+// Stop a voice, take it off the active list of its channel and hand it back to the allocator
+static inline void voice_set_idle(voice_state_t *vs)
 {
-    if (sensitivity_idx < 0 || sensitivity_idx >= 25)
-    {
-        sensitivity_idx = 2; // Default to +/- 2 semitones if out of range
-    }
+    vs->env.state = IDLE;
+    channel_voice_mask[vs->assigned_channel_num] &= ~VOICE_MASK_BIT(vs - voice_state);
+    voice_alloc_free(vs - voice_state);
+}
 
-    if (PITCH_BEND_INTERPOLATED_TABLE_SIZE == 0)
-        return float_to_q8(1.0f);
-    if (PITCH_BEND_INTERPOLATED_TABLE_SIZE == 1)
-        return pitch_bend_factors_interpolated[sensitivity_idx][0];
+// Channel volume, expression and pan with a note's velocity and its tone's output gain as a stereo gain pair,
+// for the melodic voices and the drums alike. The gain is shifted left by makeup_shift before panning.
+stereo_t stereo_gain(int8_t ch, uint8_t velocity, uint8_t output_gain, int makeup_shift)
+{
+    ch_state_t *cs = &channel_state[ch];
+    int32_t gain = fp_mul(cs->volume, (int32_t)cs->expression * FP_MAX / 127); // Channel gain
+    gain = (gain * velocity) >> 7;                                            // Velocity scaling (0 to 127)
+    gain = (gain * output_gain) >> 7;                                         // Output gain
+    gain <<= makeup_shift;
+    stereo_t pair;
+    pair.ch.left = fp_mul(gain, pan_table[cs->pan][0]);
+    pair.ch.right = fp_mul(gain, pan_table[cs->pan][1]);
+    return pair;
+}
 
-    const uint32_t original_table_max_input = PITCH_BEND_ORIGINAL_TABLE_SIZE - 1;
-    const uint32_t interpolated_table_max_idx = PITCH_BEND_INTERPOLATED_TABLE_SIZE - 1;
+// Fold channel volume, expression and pan with velocity and output gain into the voice's stereo gain pair
+static void voice_update_gain(voice_state_t *vs)
+{
+    stereo_t pair = stereo_gain(vs->assigned_channel_num, (uint8_t)vs->velocity, vs->tone.output_gain,
+                                1); // Make up for the DC cut headroom
+    vs->gain.target_left = (int32_t)pair.ch.left << 16;
+    vs->gain.target_right = (int32_t)pair.ch.right << 16;
+}
 
-    if (original_table_max_input == 0)
+// Recompute the gain pairs of all active voices on a channel after a mixer change
+static void channel_update_gains(int8_t ch)
+{
+    voice_mask_t active = channel_voice_mask[ch];
+    while (active != 0)
     {
-        return pitch_bend_factors_interpolated[sensitivity_idx][0];
+        int i = VOICE_MASK_FIRST(active);
+        active &= active - 1;
+        voice_update_gain(&voice_state[i]);
     }
-    if (bend_value_midi >= original_table_max_input)
+    if (ch == DRUM_CHANNEL)
     {
-        return pitch_bend_factors_interpolated[sensitivity_idx][interpolated_table_max_idx];
+        drum_update_gains();
     }
+}
 
-    uint32_t scaled_numerator = (uint32_t)bend_value_midi * interpolated_table_max_idx;
+// Pick the osc1 wave table for the wave type and the pitch without vibrato, so harmonics stay below FS / 2
+static void voice_update_table(voice_state_t *vs)
+{
+    switch (vs->osc1.type)
+    {
+    case SQU:
+    case SAW:
+    case TRI:
+        vs->osc1.table = osc_mipmap_table(vs->osc1.type - SQU, vs->osc1.increment);
+        break;
+    default:
+        vs->osc1.table = sin_table;
+        break;
+    }
+}
 
-    int idx1 = scaled_numerator / original_table_max_input;
+// Recompute the cached oscillator increments after the increments or the vibrato factor changed
+static void voice_update_pitch(voice_state_t *vs)
+{
+    voice_update_table(vs);
+    vs->osc1.effective_increment = phase_mul_q8(vs->osc1.increment, vs->vibrato.factor);
+    vs->osc2.effective_increment = phase_mul_q8(vs->osc2.increment, vs->vibrato.factor);
+    vs->osc1.increment_slope = 0;
+    vs->osc2.increment_slope = 0;
+}
+
+// Oscillator increments for the note with the channel's pitch bend and tuning
+static void voice_update_increments(voice_state_t *vs)
+{
+    pitch_t pitch = ((pitch_t)vs->note << PITCH_NOTE_SHIFT) + channel_state[vs->assigned_channel_num].pitch_offset;
+    vs->osc1.increment = osc_pitch_increment(pitch);
+    vs->osc2.increment = (phase_t)(((uint64_t)vs->osc1.increment * (vs->tone.rm.freq_rate + 1)) / 32);
+}
 
-    uint32_t remainder = scaled_numerator % original_table_max_input;
-    uint8_t fraction_u8 = (uint8_t)((remainder * 256U) / original_table_max_input);
+// Recompute the pitch offset of a channel after a bend or tuning change and retune its active voices
+static void channel_update_pitch(int8_t ch)
+{
+    ch_state_t *cs = &channel_state[ch];
+    int32_t bend = (int32_t)cs->pitch_bend.range - 8192;
+    cs->pitch_offset = bend * cs->pitch_bend.sensitivity * 2 / 25 // bend / 8192 * cents / 100 semitones
+                       + cs->tuning.fine * (PITCH_SEMITONE / 8192) + cs->tuning.coarse * PITCH_SEMITONE;
 
-    int idx2 = idx1 + 1;
+    voice_mask_t active = channel_voice_mask[ch];
+    while (active != 0)
+    {
+        int i = VOICE_MASK_FIRST(active);
+        active &= active - 1;
+        voice_update_increments(&voice_state[i]);
+        voice_update_pitch(&voice_state[i]);
+    }
+}
+
+// Build the envelope tables for the current sample rate
+void init_envelope_tables()
+{
+    const float control_period = ENV_CONTROL_FRAMES / FS; // Seconds between envelope updates
+    const float steps_per_period = control_period / ENV_TICK_SECONDS;
 
-    q8_t val1 = pitch_bend_factors_interpolated[sensitivity_idx][idx1];
-    q8_t val2 = pitch_bend_factors_interpolated[sensitivity_idx][idx2];
+    env_linear_step_table[0] = ENV_LEVEL_MAX; // Immediate
+    env_exp_coef_table[0] = 0;
+    for (int t = 1; t < 128; t++)
+    {
+        // One envelope step moves 127 / t amplitude units, as the time parameters always did
+        int32_t units_per_step = 127 / t;
+        env_linear_step_table[t] = (int32_t)(units_per_step * steps_per_period * 65536.0f);
 
-    int32_t diff = (int32_t)val2 - (int32_t)val1;
-    int32_t term = (diff * fraction_u8) >> 8;
+        // Exponential segments fall by 60 dB in the time the linear one takes from full scale to zero
+        float segment_time = (127.0f * 128.0f / units_per_step) * ENV_TICK_SECONDS;
+        env_exp_coef_table[t] = (int32_t)(powf(0.001f, control_period / segment_time) * (float)(1 << 30));
+    }
+    env_sustain_step_unit = (int32_t)(steps_per_period * 65536.0f);
+}
 
-    return val1 + (q8_t)term;
+// Precompute the envelope rates of a new note from its tone
+static void voice_envelope_start(voice_state_t *vs)
+{
+    bool is_exponential = vs->tone.env.curve == ENV_CURVE_EXPONENTIAL;
+
+    vs->env.attack_step = env_linear_step_table[vs->tone.env.attack_time & 0x7f];
+    vs->env.decay_step = env_linear_step_table[vs->tone.env.decay_time & 0x7f];
+    vs->env.decay_coef = is_exponential ? env_exp_coef_table[vs->tone.env.decay_time & 0x7f] : 0;
+    vs->env.sustain_level = (vs->tone.env.sustain_level * 128) << 16;
+    vs->env.sustain_step = vs->tone.env.sustain_rate * env_sustain_step_unit;
+    vs->env.release_step = env_linear_step_table[vs->tone.env.release_time & 0x7f];
+    vs->env.release_coef = is_exponential ? env_exp_coef_table[vs->tone.env.release_time & 0x7f] : 0;
+
+    vs->env.level = 0;
+    vs->env.target = 0;
+    vs->env.slope = 0;
+    vs->env.countdown = 1; // First update on the next sample
+    vs->env.state = ATTACK;
+    vs->env.is_note_off_received = false;
 }
 
 void set_voice_state(voice_state_t *vs, tone_t *tone, int8_t ch, int8_t note, int8_t velocity)
 {
     // Initialize channel number
+    voice_activate(vs, ch);
     vs->assigned_channel_num = ch;
 
     // Initialize tone
@@ -141,50 +289,30 @@ void set_voice_state(voice_state_t *vs, tone_t *tone, int8_t ch, int8_t note, in
 
     // Set MIDI note number
     vs->note = note;
-    if (vs->assigned_channel_num != 9)
-    {
-        // Initialize oscillator 1
-        vs->osc1.type = tone->osc1.type;
-        vs->osc1.increment = increment_table[note];
-        vs->osc1.read_pointer = 0;
 
-        // Initialize oscillator 2
-        vs->osc2.increment = increment_table[note] * (tone->rm.freq_rate + 1) / 32;
-        vs->osc2.read_pointer = 0;
+    // Initialize oscillator 1
+    vs->osc1.type = tone->osc1.type;
+    vs->osc1.read_pointer = 0;
+    vs->osc1.noise_state = 0x2545f491u ^ ((uint32_t)note << 16) ^ (uint32_t)(vs - voice_state); // Any non-zero seed
 
-        if (ch >= 0 && ch < MAX_CHANNEL_NUM)
-        {
-            vs->pb.factor = get_interpolated_pitch_bend_factor(
-                channel_state[ch].pitch_bend.sensitivity,
-                channel_state[ch].pitch_bend.range);
-        }
-        else
-        {
-            // Default to no bend if channel is invalid
-            vs->pb.factor = get_interpolated_pitch_bend_factor(2, 8192); // Sensitivity 2, center value
-        }
+    // Initialize oscillator 2
+    vs->osc2.read_pointer = 0;
 
-        // Initialize vibrato (not used in this version)
-        vs->vibrato.increment = vibrato_table[channel_state[ch].mod.freq];
-        vs->vibrato.read_pointer = 0;
-        vs->vibrato.factor = float_to_q8(1.0f);
-        vs->vibrato.depth = channel_state[ch].mod.depth;
-        vs->vibrato.freq = channel_state[ch].mod.freq;
+    // Note pitch with the channel's pitch bend and tuning
+    voice_update_increments(vs);
 
-        // Initialize envelope
-        vs->env.amplitude = 0;
-        vs->env.state = ATTACK;
-        vs->env.counter = 0;
-        vs->env.is_note_off_received = false;
-    }
-    else
-    {
-        // Initialize PCM oscillator
-        vs->osc1.increment = 1;
-        vs->osc1.read_pointer = 0;
-        vs->env.state = ATTACK;                                      // Less likely to be deprived of voice duaring PCM playback
-        vs->pcm_initial_delay_counter = PCM_INITIAL_SILENCE_SAMPLES; // To make sure PCM playback starts after a delay
-    }
+    // Initialize vibrato (not used in this version)
+    vs->vibrato.increment = vibrato_table[channel_state[ch].mod.freq];
+    vs->vibrato.read_pointer = 0;
+    vs->vibrato.factor = float_to_q8(1.0f);
+    vs->vibrato.depth = channel_state[ch].mod.depth;
+    vs->vibrato.freq = channel_state[ch].mod.freq;
+
+    // Cache the oscillator increments for the bend and vibrato above
+    voice_update_pitch(vs);
+
+    // Initialize envelope
+    voice_envelope_start(vs);
 
     // Initialize DC cut filter
     vs->dc_cut.prev_out = 0;
@@ -195,194 +323,314 @@ void set_voice_state(voice_state_t *vs, tone_t *tone, int8_t ch, int8_t note, in
 
     // Set initial amplitude
     vs->amplitude = 0;
+
+    // Start at the target gain, the envelope takes care of the fade in
+    voice_update_gain(vs);
+    vs->gain.left = vs->gain.target_left;
+    vs->gain.right = vs->gain.target_right;
+    // Pick the render kernel for the tone
+    voice_select_kernel(vs);
+    vs->cost = kernel_cost[vs->kernel_index];
 }
 
-void voice(voice_state_t *vs)
+static void voice_envelope_tick(voice_state_t *vs)
 {
-    fp_t wave1, wave2;
-    if (vs->assigned_channel_num != 9)
+    // The ramp of the last control period has arrived at its target
+    int32_t level = vs->env.target;
+    vs->env.level = level;
+
+    switch (vs->env.state)
     {
-        // osc1
-        switch (vs->tone.osc1.type)
+    case ATTACK:
+        level += vs->env.attack_step;
+        if (level >= ENV_LEVEL_MAX)
         {
-        case SIN:
-            wave1 = sin_table[q8_to_int32_t(vs->osc1.read_pointer)];
-            break;
-        case SQU:
-            wave1 = square_table[q8_to_int32_t(vs->osc1.read_pointer)];
-            break;
-        case SAW:
-            wave1 = sawtooth_table[q8_to_int32_t(vs->osc1.read_pointer)];
-            break;
-        case TRI:
-            wave1 = triangle_table[q8_to_int32_t(vs->osc1.read_pointer)];
-            break;
-        case NOISE:
-            wave1 = noise_table[q8_to_int32_t(vs->osc1.read_pointer)];
-            break;
+            level = ENV_LEVEL_MAX;
+            vs->env.state = DECAY;
         }
-        q8_t tmp_increment = q8_mul(vs->osc1.increment, vs->pb.factor);
-        tmp_increment = q8_mul(tmp_increment, vs->vibrato.factor);
-        vs->osc1.read_pointer += tmp_increment;
-        if (vs->osc1.read_pointer >= (TABLE_LENGTH_q8))
-            vs->osc1.read_pointer -= (TABLE_LENGTH_q8);
-
-        // osc2
-        wave2 = sin_table[q8_to_int32_t(vs->osc2.read_pointer)];
-        tmp_increment = q8_mul(vs->osc2.increment, vs->pb.factor);
-        tmp_increment = q8_mul(tmp_increment, vs->vibrato.factor);
-        vs->osc2.read_pointer += tmp_increment;
-        if (vs->osc2.read_pointer >= (TABLE_LENGTH_q8))
-            vs->osc2.read_pointer -= (TABLE_LENGTH_q8);
-
-        // vibrato(LFO)
-        if (vs->vibrato.depth != 0)
+        break;
+    case DECAY:
+        if (vs->env.decay_coef != 0)
         {
-            fp_t lfo_sample_fp = sin_table[q8_to_int32_t(vs->vibrato.read_pointer)];
-            q8_t lfo_bipolar_q8 = (q8_t)(lfo_sample_fp >> 7);
-            q8_t delta_q8 = (q8_t)(((int32_t)lfo_bipolar_q8 * (int32_t)vs->vibrato.depth * 10) >> 15);
-            vs->vibrato.factor = float_to_q8(1.0f) + delta_q8;
-            vs->vibrato.read_pointer += vs->vibrato.increment;
-            if (vs->vibrato.read_pointer >= (TABLE_LENGTH_q8))
-                vs->vibrato.read_pointer -= (TABLE_LENGTH_q8);
+            level = vs->env.sustain_level + (int32_t)(((int64_t)(level - vs->env.sustain_level) * vs->env.decay_coef) >> 30);
+            if (level - vs->env.sustain_level < ENV_EXP_END_LEVEL)
+            {
+                level = vs->env.sustain_level;
+            }
         }
         else
         {
-            vs->vibrato.factor = float_to_q8(1.0f);
+            level -= vs->env.decay_step;
         }
-
-        // ring modulation
-        if (vs->tone.rm.freq_rate != 0)
+        if (level <= vs->env.sustain_level)
         {
-            wave2 = wave2 * vs->tone.rm.rm_gain >> 7; // Apply ring modulation gain
-            wave1 = fp_mul(wave1, wave2);
+            level = vs->env.sustain_level;
+            vs->env.state = SUSTAIN;
         }
-
-        // env
-        if (vs->env.counter == 0)
+        break;
+    case SUSTAIN:
+        level -= vs->env.sustain_step;
+        if (level <= 0)
+        {
+            level = 0;
+            vs->env.state = RELEASE;
+        }
+        break;
+    case RELEASE:
+        if (level <= 0)
         {
-            switch (vs->env.state)
+            // Silent since the last control period
+            vs->env.level = 0;
+            vs->env.slope = 0;
+            vs->env.state = IDLE; // Handed back to the allocator after the block, see master_block()
+            return;
+        }
+        if (vs->env.release_coef != 0)
+        {
+            level = (int32_t)(((int64_t)level * vs->env.release_coef) >> 30);
+            if (level < ENV_EXP_END_LEVEL)
             {
-            case ATTACK:
-                if (vs->tone.env.attack_time != 0)
-                {
-                    vs->env.amplitude += 127 / vs->tone.env.attack_time;
-                }
-                else
-                {
-                    vs->env.amplitude = 127 * 128; // Immediate attack
-                }
-                if (vs->env.amplitude >= 127 * 128)
-                {
-                    vs->env.amplitude = 127 * 128;
-                    vs->env.state = DECAY;
-                }
-                break;
-            case DECAY:
-                if (vs->tone.env.decay_time != 0)
-                {
-                    vs->env.amplitude -= 127 / vs->tone.env.decay_time;
-                }
-                else
-                {
-                    vs->env.amplitude = vs->tone.env.sustain_level * 128; // Immediate decay
-                }
-                if (vs->env.amplitude <= vs->tone.env.sustain_level * 128)
-                {
-                    vs->env.amplitude = vs->tone.env.sustain_level * 128;
-                    vs->env.state = SUSTAIN;
-                }
-                break;
-            case SUSTAIN:
-                vs->env.amplitude -= vs->tone.env.sustain_rate;
-                if (vs->env.amplitude <= 0)
-                {
-                    vs->env.amplitude = 0;
-                    vs->env.state = RELEASE;
-                }
-                break;
-            case RELEASE:
-                if (vs->tone.env.release_time != 0)
-                {
-                    vs->env.amplitude -= 127 / vs->tone.env.release_time;
-                }
-                else
-                {
-                    vs->env.amplitude = 0; // Immediate release
-                }
-                if (vs->env.amplitude <= 0)
-                {
-                    vs->env.amplitude = 0;
-                    vs->env.state = IDLE;
-                }
-                break;
-            case IDLE:
-                vs->env.amplitude = 0; // No output in idle state
-                break;
-            default:
-                break;
+                level = 0;
             }
         }
-        vs->env.counter++;
-        if (vs->env.counter >= ENV_COUNTER_THRESHOLD)
+        else
+        {
+            level -= vs->env.release_step;
+        }
+        if (level < 0)
         {
-            vs->env.counter = 0;
+            level = 0;
         }
+        break;
+    case IDLE:
+        level = 0; // No output in idle state
+        break;
+    default:
+        break;
+    }
 
-        fp_t adsr_gain = vs->env.amplitude * (FP_MAX >> 14); // Scale amplitude to fixed-point range
-        wave1 = fp_mul(wave1, adsr_gain);
+    // Interpolate the amplitude towards the new level over the next control period
+    vs->env.target = level;
+    vs->env.slope = (level - vs->env.level) >> ENV_CONTROL_SHIFT;
+    vs->env.countdown = ENV_CONTROL_FRAMES;
+}
+
+// Move the vibrato LFO on by one control period and ramp the oscillator increments towards the new pitch
+static void voice_vibrato_tick(voice_state_t *vs)
+{
+    phase_t osc1_start = vs->osc1.effective_increment;
+    phase_t osc2_start = vs->osc2.effective_increment;
+
+    vs->vibrato.read_pointer += vs->vibrato.increment * ENV_CONTROL_FRAMES; // Wraps around by overflow
+
+    fp_t lfo_sample_fp = osc_sin(vs->vibrato.read_pointer);
+    q8_t lfo_bipolar_q8 = (q8_t)(lfo_sample_fp >> 7);
+    q8_t delta_q8 = (q8_t)(((int32_t)lfo_bipolar_q8 * (int32_t)vs->vibrato.depth * 10) >> 15);
+    vs->vibrato.factor = float_to_q8(1.0f) + delta_q8;
+
+    voice_update_pitch(vs);
+    vs->osc1.increment_slope = (int32_t)(vs->osc1.effective_increment - osc1_start) >> ENV_CONTROL_SHIFT;
+    vs->osc2.increment_slope = (int32_t)(vs->osc2.effective_increment - osc2_start) >> ENV_CONTROL_SHIFT;
+    vs->osc1.effective_increment = osc1_start;
+    vs->osc2.effective_increment = osc2_start;
+}
+
+// Render kernels
+//
+// A voice renders through the kernel chosen by voice_select_kernel(). Each kernel is voice_render_osc()
+// instantiated with a fixed source (wave table or noise) and fixed ring modulation/vibrato switches, so
+// the compiler drops the unused stages and the inner loop has no per-sample feature tests. The envelope
+// runs in stretches between its control updates, so its tick stays out of the inner loop as well.
+// Table oscillators run as osc_stream_t streams, which use the interpolators on the device. osc1 reads
+// the table picked by voice_update_table(), a band-limited one for square, sawtooth and triangle.
+static inline __attribute__((always_inline)) size_t voice_render_osc(voice_state_t *vs, fp_t *out, size_t frames,
+                                                                      bool use_noise, bool use_rm, bool use_vibrato)
+{
+    osc_stream_t osc1_stream;
+    osc_stream_t osc2_stream;
+    phase_t osc1_increment = vs->osc1.effective_increment;
+    phase_t osc2_increment = vs->osc2.effective_increment;
+    int32_t osc1_increment_slope = vs->osc1.increment_slope;
+    int32_t osc2_increment_slope = vs->osc2.increment_slope;
+    uint32_t noise_state = vs->osc1.noise_state;
+    const int32_t rm_gain = vs->tone.rm.rm_gain;
+    fp_t prev_in = vs->dc_cut.prev_in;
+    fp_t prev_out = vs->dc_cut.prev_out;
+    int32_t level = vs->env.level;
+
+    if (!use_noise)
+    {
+        osc_stream_start(&osc1_stream, 0, vs->osc1.table, vs->osc1.read_pointer, osc1_increment);
     }
-    else
+    if (use_rm)
     {
-        // PCM oscillator
-        if (vs->pcm_initial_delay_counter > 0)
+        osc_stream_start(&osc2_stream, 1, sin_table, vs->osc2.read_pointer, osc2_increment);
+    }
+
+    size_t n = 0;
+    while (n < frames)
+    {
+        // Render up to the next envelope update
+        size_t run = frames - n;
+        if (vs->env.countdown < run)
         {
-            wave1 = 0; // output silence during initial delay
-            vs->pcm_initial_delay_counter--;
+            run = vs->env.countdown;
         }
-        else
+        const size_t end = n + run;
+        const int32_t slope = vs->env.slope;
+
+        for (; n < end; n++)
         {
-            if ((PCM_START_NOTE <= vs->note) && (vs->note <= PCM_END_NOTE))
+            // osc1
+            fp_t wave1 = use_noise ? osc_noise(&noise_state) : osc_stream_next(&osc1_stream);
+
+            // osc2 and ring modulation
+            if (use_rm)
             {
-                int32_t pcm_note_offset = vs->note - PCM_START_NOTE; // Calculate PCM note offset
-                const pcm_sample_t *sample = &pcm_samples[pcm_note_offset];
+                fp_t wave2 = osc_stream_next(&osc2_stream);
+                wave2 = wave2 * rm_gain >> 7; // Apply ring modulation gain
+                wave1 = fp_mul(wave1, wave2);
+            }
 
-                if (sample->data != NULL && sample->length > 0 && vs->osc1.read_pointer < sample->length)
+            // vibrato (pitch interpolated between control updates)
+            if (use_vibrato)
+            {
+                osc1_increment += osc1_increment_slope;
+                osc2_increment += osc2_increment_slope;
+                if (!use_noise)
                 {
-                    wave1 = sample->data[vs->osc1.read_pointer];
-                    vs->osc1.read_pointer++;
-                    if (vs->osc1.read_pointer >= sample->length)
-                    {
-                        vs->env.state = IDLE;
-                    }
+                    osc_stream_set_increment(&osc1_stream, osc1_increment);
                 }
-                else
+                if (use_rm)
                 {
-                    wave1 = 0;
-                    vs->env.state = IDLE;
-                    vs->osc1.read_pointer = 0;
+                    osc_stream_set_increment(&osc2_stream, osc2_increment);
                 }
             }
-            else
+
+            // env (interpolated between control updates)
+            wave1 = fp_mul(wave1, (fp_t)(level >> 16));
+            level += slope;
+
+            // DC cut (input halved for headroom, voice_update_gain() makes up for it)
+            fp_t signal_for_dc_cut = wave1 >> 1;
+            prev_out = fp_mul(HPF_ALPHA, (prev_out + signal_for_dc_cut - prev_in));
+            prev_in = signal_for_dc_cut;
+            out[n] = prev_out;
+        }
+
+        vs->env.level = level;
+        vs->env.countdown -= run;
+        if (vs->env.countdown == 0)
+        {
+            voice_envelope_tick(vs);
+            level = vs->env.level;
+            if (vs->env.state == IDLE)
+            {
+                break; // The voice finished inside this block
+            }
+            if (use_vibrato)
             {
-                vs->env.state = IDLE;
-                wave1 = 0;
-                vs->osc1.read_pointer = 0;
+                voice_vibrato_tick(vs);
+                osc1_increment = vs->osc1.effective_increment;
+                osc2_increment = vs->osc2.effective_increment;
+                osc1_increment_slope = vs->osc1.increment_slope;
+                osc2_increment_slope = vs->osc2.increment_slope;
+                if (!use_noise)
+                {
+                    osc_stream_set_increment(&osc1_stream, osc1_increment);
+                }
+                if (use_rm)
+                {
+                    osc_stream_set_increment(&osc2_stream, osc2_increment);
+                }
             }
         }
     }
 
-    // Velocity scaling
-    wave1 = (fp_t)((int32_t)(wave1) * (int32_t)(vs->velocity) >> 7); // Scale wave1 by velocity (0 to 127)
+    if (!use_noise)
+    {
+        vs->osc1.read_pointer = osc_stream_phase(&osc1_stream);
+    }
+    if (use_rm)
+    {
+        vs->osc2.read_pointer = osc_stream_phase(&osc2_stream);
+    }
+    vs->osc1.noise_state = noise_state;
+    if (use_vibrato)
+    {
+        vs->osc1.effective_increment = osc1_increment;
+        vs->osc2.effective_increment = osc2_increment;
+    }
+    vs->dc_cut.prev_in = prev_in;
+    vs->dc_cut.prev_out = prev_out;
+    vs->amplitude = prev_out;
+    return n;
+}
+
+#define DEFINE_VOICE_KERNELS(name, noise)                                                 \
+    static size_t voice_render_##name(voice_state_t *vs, fp_t *out, size_t frames)         \
+    {                                                                                      \
+        return voice_render_osc(vs, out, frames, noise, false, false);                     \
+    }                                                                                      \
+    static size_t voice_render_##name##_rm(voice_state_t *vs, fp_t *out, size_t frames)    \
+    {                                                                                      \
+        return voice_render_osc(vs, out, frames, noise, true, false);                      \
+    }                                                                                      \
+    static size_t voice_render_##name##_vib(voice_state_t *vs, fp_t *out, size_t frames)   \
+    {                                                                                      \
+        return voice_render_osc(vs, out, frames, noise, false, true);                      \
+    }                                                                                      \
+    static size_t voice_render_##name##_rm_vib(voice_state_t *vs, fp_t *out, size_t frames) \
+    {                                                                                      \
+        return voice_render_osc(vs, out, frames, noise, true, true);                       \
+    }
 
-    // Output gain
-    vs->amplitude = (fp_t)((int32_t)(wave1) * (int32_t)(vs->tone.output_gain) >> 7);
+DEFINE_VOICE_KERNELS(table, false)
+DEFINE_VOICE_KERNELS(noise, true)
+
+#define VOICE_KERNEL_ROW(name) {voice_render_##name, voice_render_##name##_rm, voice_render_##name##_vib, voice_render_##name##_rm_vib}
+
+// Oscillator kernels indexed by [noise][ring modulation | vibrato << 1]
+static const voice_kernel_t voice_kernels[2][4] = {
+    VOICE_KERNEL_ROW(table), // SIN, SQU, SAW, TRI
+    VOICE_KERNEL_ROW(noise), // NOISE
+};
+
+// Pick the render kernel matching the features the voice uses right now
+static void voice_select_kernel(voice_state_t *vs)
+{
+    bool use_rm = vs->tone.rm.freq_rate != 0;
+    bool use_vibrato = vs->vibrato.depth != 0;
+    bool had_vibrato = (vs->kernel_index & 2) != 0;
+    if (!use_vibrato && (had_vibrato || vs->vibrato.factor != float_to_q8(1.0f)))
+    {
+        // Back to the plain pitch when vibrato stops. The factor alone can already be back at 1.0
+        // while the increments are still partway along the last control period's ramp.
+        vs->vibrato.factor = float_to_q8(1.0f);
+        voice_update_pitch(vs);
+    }
+    vs->osc1.type = (vs->tone.osc1.type <= NOISE) ? vs->tone.osc1.type : SIN;
+    voice_update_table(vs); // The tone may have changed the wave type
+    vs->kernel_index = ((vs->osc1.type == NOISE) << 2) | (use_vibrato << 1) | use_rm;
+    vs->kernel = voice_kernels[vs->osc1.type == NOISE][use_rm | (use_vibrato << 1)];
+}
 
-    // // DC cut
-    fp_t signal_for_dc_cut = vs->amplitude;
-    vs->amplitude = fp_mul(HPF_ALPHA, (vs->dc_cut.prev_out + signal_for_dc_cut - vs->dc_cut.prev_in));
-    vs->dc_cut.prev_in = signal_for_dc_cut;
-    vs->dc_cut.prev_out = vs->amplitude;
+// Advance a voice by a number of frames without producing output (used for muted channels)
+static void voice_skip(voice_state_t *vs, size_t frames)
+{
+    // Only the envelope has to move on so the voice still releases and frees itself
+    while (frames > 0 && vs->env.state != IDLE)
+    {
+        uint32_t step = vs->env.countdown < frames ? vs->env.countdown : frames;
+        vs->env.level += vs->env.slope * (int32_t)step;
+        vs->env.countdown -= step;
+        frames -= step;
+        if (vs->env.countdown == 0)
+        {
+            voice_envelope_tick(vs);
+        }
+    }
+    vs->amplitude = 0;
 }
 
 void init_channel(int8_t ch_to_init)
@@ -395,8 +643,11 @@ void init_channel(int8_t ch_to_init)
             channel_state[i].tone = tone_gm[0];          // Initialize channel tone with GM default
             channel_state[i].volume = float_to_fp(0.1f); // Default volume
             channel_state[i].expression = 127;           // Default expression
-            channel_state[i].pitch_bend.sensitivity = 2; // Default sensitivity
-            channel_state[i].pitch_bend.range = 8192;    // Default range
+            channel_state[i].pitch_bend.sensitivity = 200; // Default sensitivity (2 semitones)
+            channel_state[i].pitch_bend.range = 8192;      // Default range
+            channel_state[i].tuning.fine = 0;              // No fine tuning
+            channel_state[i].tuning.coarse = 0;            // No coarse tuning
+            channel_state[i].pitch_offset = 0;             // Center bend, no tuning
             channel_state[i].mod.depth = 0;              // Default modulation depth
             channel_state[i].mod.freq = 64;              // Default modulation frequency
             channel_state[i].is_hold_on = false;         // Hold is off by default
@@ -421,8 +672,11 @@ void init_channel(int8_t ch_to_init)
         channel_state[ch_to_init].tone = tone_gm[0];
         channel_state[ch_to_init].volume = float_to_fp(0.1f);
         channel_state[ch_to_init].expression = 127;
-        channel_state[ch_to_init].pitch_bend.sensitivity = 2;
+        channel_state[ch_to_init].pitch_bend.sensitivity = 200;
         channel_state[ch_to_init].pitch_bend.range = 8192;
+        channel_state[ch_to_init].tuning.fine = 0;
+        channel_state[ch_to_init].tuning.coarse = 0;
+        channel_state[ch_to_init].pitch_offset = 0;
         channel_state[ch_to_init].mod.depth = 0;
         channel_state[ch_to_init].mod.freq = 64;
         channel_state[ch_to_init].is_hold_on = false;
@@ -479,226 +733,345 @@ void init_reverb()
     reverb_state.dry_level = float_to_fp(1.0f) - reverb_state.wet_level;
 }
 
+void init_voices()
+{
+    for (int i = 0; i < MAX_VOICE_NUM; i++)
+    {
+        voice_state[i].assigned_channel_num = 0;
+        voice_state[i].env.state = IDLE;
+        voice_state[i].amplitude = 0;
+        voice_state[i].osc1.table = sin_table;
+        voice_state[i].kernel = voice_render_table;
+        voice_state[i].kernel_index = 0;
+        voice_state[i].cost = 0;
+    }
+    for (int i = 0; i < MAX_CHANNEL_NUM; i++)
+    {
+        channel_voice_mask[i] = 0;
+    }
+    voice_alloc_init();
+    drum_init();
+}
+
 void init_master()
 {
     master_state.dc_cut.prev_out.u32 = 0;
     master_state.dc_cut.prev_in.u32 = 0;
-    init_channel(-1); // Initialize all channels
-    init_reverb();    // Initialize reverb
+    init_channel(-1);         // Initialize all channels
+    init_voices();            // Initialize voices
+    init_envelope_tables();   // Initialize envelope rates
+    init_oscillator_interp(); // Set up the interpolators of the rendering core
+    init_reverb();            // Initialize reverb
 }
 
 void note_on(midi_t *midi, voice_state_t *vs)
 {
-    int voice_to_use = -1;
-    int idle_candidate = -1;
-    int releasing_candidate = -1;
-    int active_steal_candidate = -1;
-
-    // Single pass to find the best candidate voice based on priority:
-    // 1. IDLE voice (highest priority)
-    // 2. RELEASING voice
-    // 3. ACTIVE voice (steal - lowest priority)
-    for (int i = 0; i < MAX_VOICE_NUM; i++)
+    if (midi->ch == DRUM_CHANNEL)
     {
-        if (vs[i].env.state == IDLE)
-        {
-            idle_candidate = i;
-            break; // Found an IDLE voice, which is the highest priority. No need to search further.
-        }
-        // If no IDLE voice found yet in this iteration, check for other types.
-        // Store the first encountered RELEASING voice.
-        if (releasing_candidate == -1 && vs[i].env.state == RELEASE)
-        {
-            releasing_candidate = i;
-        }
-        // Store the first encountered ACTIVE (ATTACK, DECAY, SUSTAIN) voice for potential stealing.
-        if (active_steal_candidate == -1 &&
-            (vs[i].env.state == ATTACK || vs[i].env.state == DECAY || vs[i].env.state == SUSTAIN))
-        {
-            active_steal_candidate = i;
-        }
+        drum_note_on(midi->msg[1], midi->msg[2]);
+        return;
     }
 
-    // Determine which voice to use based on the candidates found, respecting priority.
-    if (idle_candidate != -1)
-    {
-        voice_to_use = idle_candidate;
-        gpio_put(PICO_DEFAULT_LED_PIN, 0);
-    }
-    else if (releasing_candidate != -1)
-    {
-        voice_to_use = releasing_candidate;
-        gpio_put(PICO_DEFAULT_LED_PIN, 0);
-    }
-    else if (active_steal_candidate != -1)
-    {
-        voice_to_use = active_steal_candidate;
-        gpio_put(PICO_DEFAULT_LED_PIN, 1); // Indicate voice stealing by turning LED on.
-    }
-    // If voice_to_use is still -1 at this point, it means no suitable voice was found
-    // (e.g., MAX_VOICE_NUM could be 0, or all voices are in an unexpected state).
+    // A voice within the channel limits, stealing the least audible of the oldest voices if needed
+    bool stolen;
+    int voice_to_use = voice_alloc_take(midi->ch, midi->msg[1], &stolen);
+    gpio_put(PICO_DEFAULT_LED_PIN, stolen || voice_to_use == VOICE_NONE); // Indicate stolen voices and dropped notes
 
-    if (voice_to_use != -1)
+    if (voice_to_use != VOICE_NONE)
     {
         set_voice_state(&vs[voice_to_use], &channel_state[midi->ch].tone, midi->ch, midi->msg[1], midi->msg[2]);
     }
-    else
-    {
-        // No voice found.
-        gpio_put(PICO_DEFAULT_LED_PIN, 1);
-    }
 }
 
 void note_off(midi_t *midi, voice_state_t *vs)
 {
-    // Search for the voice corresponding to the MIDI note
-    for (int i = 0; i < MAX_VOICE_NUM; i++)
+    // Release the voices playing the note
+    for (int i = voice_alloc_find(midi->ch, midi->msg[1]); i != VOICE_NONE; i = voice_alloc_next(i))
     {
-        if (vs[i].env.state != IDLE && vs[i].assigned_channel_num == midi->ch && vs[i].note == midi->msg[1])
+        vs[i].env.is_note_off_received = true; // Set flag to indicate note off received
+        if (channel_state[midi->ch].is_hold_on == false)
         {
-            vs[i].env.is_note_off_received = true; // Set flag to indicate note off received
-            if (channel_state[midi->ch].is_hold_on == false)
-            {
-                vs[i].env.state = RELEASE;
-            }
+            vs[i].env.state = RELEASE;
         }
     }
 }
 
-stereo_t channel(voice_state_t *vs, int8_t ch)
+// Render the voices in a mask and mix them into out with their stereo gain pairs. Only the voices
+// themselves are written, so two cores can mix disjoint masks at the same time. Voices that finish
+// go IDLE and are handed back to the allocator by master_block().
+void mix_voices(voice_state_t *vs, voice_mask_t voices, stereo_t *out, size_t frames)
 {
-    fp_t ch_gain = channel_state[ch].volume;                                              // Get channel volume
-    ch_gain = fp_mul(ch_gain, float_to_fp((float)channel_state[ch].expression / 127.0f)); // Apply expression control more accurately
-    fp_t mono_signal = 0;                                                                 // Accumulate mono signal for the channel
-    stereo_t output;
-    output.u32 = 0; // Initialize output
-    int8_t pan_value = channel_state[ch].pan;
-
-    // Process all voices for the specified channel and sum them into a mono signal
-    for (int i = 0; i < MAX_VOICE_NUM; i++)
+    // Per core rather than on the stack: core0 mixes from its FIFO interrupt, on top of the USB stack
+    static fp_t core_voice_out[2][MAX_RENDER_BLOCK_FRAMES];
+    int core = render_core();
+    fp_t *voice_out = core_voice_out[core];
+
+    while (voices != 0)
     {
-        if (vs[i].assigned_channel_num == ch && vs[i].env.state != IDLE) // Only process active voices
+        int i = VOICE_MASK_FIRST(voices);
+        voices &= voices - 1;
+        voice_state_t *v = &vs[i];
+        uint32_t start = render_cycles();
+
+        if ((v->gain.left | v->gain.right | v->gain.target_left | v->gain.target_right) == 0)
         {
-            voice(&vs[i]); // Process the voice
-            mono_signal += fp_mul(vs[i].amplitude, ch_gain);
+            // Silent voice (muted channel): keep the envelope running but skip the oscillators and mixing
+            voice_skip(v, frames);
         }
-    }
+        else
+        {
+            // Ramp the gains to their targets across the block to avoid zipper noise
+            int32_t gain_left = v->gain.left;
+            int32_t gain_right = v->gain.right;
+            int32_t step_left = (v->gain.target_left - gain_left) / (int32_t)frames;
+            int32_t step_right = (v->gain.target_right - gain_right) / (int32_t)frames;
+
+            // Render the voice, it stops early if it finishes inside this block
+            size_t rendered = v->kernel(v, voice_out, frames);
 
-    // Pan control using precomputed table
-    output.ch.left = fp_mul(mono_signal, pan_table[pan_value][0]);
-    output.ch.right = fp_mul(mono_signal, pan_table[pan_value][1]);
+            // Pan and accumulate both channels at once, clipping instead of wrapping around
+            for (size_t n = 0; n < rendered; n++)
+            {
+                fp2_t gains = fp2_pack_upper(gain_left, gain_right);
+                out[n].u32 = fp2_add_sat(out[n].u32, fp2_scale(voice_out[n], gains));
+                gain_left += step_left;
+                gain_right += step_right;
+            }
+            v->gain.left = v->gain.target_left;
+            v->gain.right = v->gain.target_right;
+        }
 
-    return output;
+        // Running average of the cost per frame, used to share the voices between the cores
+        int32_t cost = (int32_t)(render_cycles_since(start) / frames);
+        v->cost += (cost - v->cost) / 4;
+        core_kernel_cost[core][v->kernel_index] = v->cost;
+        core_kernel_measured[core] |= 1 << v->kernel_index;
+    }
 }
 
-stereo_t reverb(stereo_t input)
+void reverb_block(stereo_t *buffer, size_t frames)
 {
-    stereo_t wet_out;
-    wet_out.u32 = 0;
-    stereo_t final_out;
+    stereo_t wet[MAX_RENDER_BLOCK_FRAMES];
 
-    fp_t comb_sum_l = 0;
-    fp_t comb_sum_r = 0;
+    for (size_t n = 0; n < frames; n++)
+    {
+        wet[n].u32 = 0;
+    }
 
     // --- Parallel Comb Filters ---
     for (int i = 0; i < REVERB_COMB_FILTER_COUNT; i++)
     {
-        uint16_t delay_len = reverb_state.comb_delay_times[i];
+        fp_t *buffer_l = reverb_state.comb_buffer_l[i];
+        fp_t *buffer_r = reverb_state.comb_buffer_r[i];
+        fp_t g = reverb_state.comb_feedback_gain[i];
         uint16_t w_ptr = reverb_state.comb_write_ptr[i];
-        uint16_t r_ptr = (w_ptr - delay_len + MAX_REVERB_COMB_DELAY_SAMPLES) % MAX_REVERB_COMB_DELAY_SAMPLES;
-
-        fp_t delayed_l = reverb_state.comb_buffer_l[i][r_ptr];
-        fp_t delayed_r = reverb_state.comb_buffer_r[i][r_ptr];
+        uint16_t r_ptr = (w_ptr - reverb_state.comb_delay_times[i] + MAX_REVERB_COMB_DELAY_SAMPLES) % MAX_REVERB_COMB_DELAY_SAMPLES;
 
-        // y[n] = x[n] + g * y[n-M]
-        fp_t current_out_l = input.ch.left + fp_mul(reverb_state.comb_feedback_gain[i], delayed_l);
-        fp_t current_out_r = input.ch.right + fp_mul(reverb_state.comb_feedback_gain[i], delayed_r);
+        for (size_t n = 0; n < frames; n++)
+        {
+            // y[n] = x[n] + g * y[n-M]
+            fp_t current_out_l = fp_sat(buffer[n].ch.left + fp_mul(g, buffer_l[r_ptr]));
+            fp_t current_out_r = fp_sat(buffer[n].ch.right + fp_mul(g, buffer_r[r_ptr]));
 
-        reverb_state.comb_buffer_l[i][w_ptr] = current_out_l;
-        reverb_state.comb_buffer_r[i][w_ptr] = current_out_r;
+            buffer_l[w_ptr] = current_out_l;
+            buffer_r[w_ptr] = current_out_r;
 
-        comb_sum_l += current_out_l;
-        comb_sum_r += current_out_r;
+            wet[n].u32 = fp2_add_sat(wet[n].u32, fp2_pack(current_out_l, current_out_r));
 
-        reverb_state.comb_write_ptr[i] = (w_ptr + 1) % MAX_REVERB_COMB_DELAY_SAMPLES;
+            if (++w_ptr >= MAX_REVERB_COMB_DELAY_SAMPLES)
+                w_ptr = 0;
+            if (++r_ptr >= MAX_REVERB_COMB_DELAY_SAMPLES)
+                r_ptr = 0;
+        }
+        reverb_state.comb_write_ptr[i] = w_ptr;
     }
 
     // Average the output of comb filters
-    wet_out.ch.left = comb_sum_l / REVERB_COMB_FILTER_COUNT;
-    wet_out.ch.right = comb_sum_r / REVERB_COMB_FILTER_COUNT;
+    for (size_t n = 0; n < frames; n++)
+    {
+        wet[n].ch.left = wet[n].ch.left / REVERB_COMB_FILTER_COUNT;
+        wet[n].ch.right = wet[n].ch.right / REVERB_COMB_FILTER_COUNT;
+    }
 
     // --- Series Allpass Filters ---
     // Output of comb stage is input to allpass stage
-    fp_t allpass_stage_input_l = wet_out.ch.left;
-    fp_t allpass_stage_input_r = wet_out.ch.right;
-
     for (int i = 0; i < REVERB_ALLPASS_FILTER_COUNT; i++)
     {
-        uint16_t delay_len = reverb_state.allpass_delay_times[i];
-        uint16_t w_ptr = reverb_state.allpass_write_ptr[i];
-        uint16_t r_ptr = (w_ptr - delay_len + MAX_REVERB_ALLPASS_DELAY_SAMPLES) % MAX_REVERB_ALLPASS_DELAY_SAMPLES;
+        fp_t *buffer_l = reverb_state.allpass_buffer_l[i];
+        fp_t *buffer_r = reverb_state.allpass_buffer_r[i];
         fp_t g = reverb_state.allpass_feedback_gain[i];
+        uint16_t w_ptr = reverb_state.allpass_write_ptr[i];
+        uint16_t r_ptr = (w_ptr - reverb_state.allpass_delay_times[i] + MAX_REVERB_ALLPASS_DELAY_SAMPLES) % MAX_REVERB_ALLPASS_DELAY_SAMPLES;
 
-        fp_t x_l = allpass_stage_input_l;
-        fp_t x_r = allpass_stage_input_r;
-
-        fp_t delayed_val_l = reverb_state.allpass_buffer_l[i][r_ptr]; // d[n-M]
-        fp_t delayed_val_r = reverb_state.allpass_buffer_r[i][r_ptr]; // d[n-M]
+        for (size_t n = 0; n < frames; n++)
+        {
+            fp_t x_l = wet[n].ch.left;
+            fp_t x_r = wet[n].ch.right;
 
-        // Allpass: y(n) = d(n-M) + g*x(n)
-        //          d(n) = x(n) - g*y(n)
-        fp_t y_l = delayed_val_l + fp_mul(g, x_l);
-        fp_t y_r = delayed_val_r + fp_mul(g, x_r);
+            // Allpass: y(n) = d(n-M) + g*x(n)
+            //          d(n) = x(n) - g*y(n)
+            fp_t y_l = fp_sat(buffer_l[r_ptr] + fp_mul(g, x_l));
+            fp_t y_r = fp_sat(buffer_r[r_ptr] + fp_mul(g, x_r));
 
-        reverb_state.allpass_buffer_l[i][w_ptr] = x_l - fp_mul(g, y_l);
-        reverb_state.allpass_buffer_r[i][w_ptr] = x_r - fp_mul(g, y_r);
+            buffer_l[w_ptr] = fp_sat(x_l - fp_mul(g, y_l));
+            buffer_r[w_ptr] = fp_sat(x_r - fp_mul(g, y_r));
 
-        allpass_stage_input_l = y_l; // Output of this filter is input to next
-        allpass_stage_input_r = y_r;
+            wet[n].ch.left = y_l; // Output of this filter is input to next
+            wet[n].ch.right = y_r;
 
-        reverb_state.allpass_write_ptr[i] = (w_ptr + 1) % MAX_REVERB_ALLPASS_DELAY_SAMPLES;
+            if (++w_ptr >= MAX_REVERB_ALLPASS_DELAY_SAMPLES)
+                w_ptr = 0;
+            if (++r_ptr >= MAX_REVERB_ALLPASS_DELAY_SAMPLES)
+                r_ptr = 0;
+        }
+        reverb_state.allpass_write_ptr[i] = w_ptr;
     }
-    wet_out.ch.left = allpass_stage_input_l;
-    wet_out.ch.right = allpass_stage_input_r;
 
     // --- Wet/Dry Mix ---
-    final_out.ch.left = fp_mul(input.ch.left, reverb_state.dry_level) + fp_mul(wet_out.ch.left, reverb_state.wet_level);
-    final_out.ch.right = fp_mul(input.ch.right, reverb_state.dry_level) + fp_mul(wet_out.ch.right, reverb_state.wet_level);
+    // One dual multiply-accumulate per channel: dry * x + wet * y, saturated
+    fp2_t levels = fp2_pack(reverb_state.dry_level, reverb_state.wet_level);
+    for (size_t n = 0; n < frames; n++)
+    {
+        fp_t left = fp2_dot_sat(fp2_pack(buffer[n].ch.left, wet[n].ch.left), levels);
+        fp_t right = fp2_dot_sat(fp2_pack(buffer[n].ch.right, wet[n].ch.right), levels);
+        buffer[n].ch.left = left;
+        buffer[n].ch.right = right;
+    }
+}
 
-    return final_out;
+// Take the kernel costs measured by the cores in this span, the average where both measured a kernel
+static void kernel_cost_merge()
+{
+    for (int k = 0; k < 8; k++)
+    {
+        uint32_t sum = 0;
+        uint32_t count = 0;
+        for (int core = 0; core < 2; core++)
+        {
+            if (core_kernel_measured[core] & (1 << k))
+            {
+                sum += core_kernel_cost[core][k];
+                count++;
+            }
+        }
+        if (count != 0)
+        {
+            kernel_cost[k] = (uint16_t)(sum / count);
+        }
+    }
+    core_kernel_measured[0] = 0;
+    core_kernel_measured[1] = 0;
 }
 
-stereo_t master(voice_state_t *vs)
+static void master_block(voice_state_t *vs, stereo_t *out, size_t frames)
 {
-    stereo_t mixed_signal, processed_signal;
-    mixed_signal.u32 = 0; // Initialize to zero
+    for (size_t n = 0; n < frames; n++)
+    {
+        out[n].u32 = 0; // Initialize to zero
+    }
 
+    voice_mask_t active = 0;
     for (int i = 0; i < MAX_CHANNEL_NUM; i++)
     {
-        stereo_t ch_signal = channel(vs, i);
-        mixed_signal.ch.left += ch_signal.ch.left;
-        mixed_signal.ch.right += ch_signal.ch.right;
+        active |= channel_voice_mask[i];
     }
 
-    // Apply Reverb
-    processed_signal = reverb(mixed_signal);
-    // processed_signal = mixed_signal;
+#if RENDER_SPLIT
+    // Core0 renders part of the voices into its own buffer meanwhile, then both are summed.
+    // The sums saturate, so how the voices are shared only shows in the output while the mix clips.
+    voice_mask_t shared = render_split_enabled ? render_split_partition(active, drum_cost) : 0;
+    if (shared != 0)
+    {
+        render_split_start(shared, frames);
+    }
+    mix_voices(vs, active & ~shared, out, frames);
+    uint32_t start = render_cycles();
+    drum_render(out, frames);
+    drum_cost = render_cycles_since(start) / frames;
+    if (shared != 0)
+    {
+        const stereo_t *shared_out = render_split_finish();
+        for (size_t n = 0; n < frames; n++)
+        {
+            out[n].u32 = fp2_add_sat(out[n].u32, shared_out[n].u32);
+        }
+    }
+#else
+    mix_voices(vs, active, out, frames);
+    drum_render(out, frames);
+#endif
+    kernel_cost_merge();
 
-    // Store signal before DC cut for prev_in
-    stereo_t signal_before_dc_cut = processed_signal;
+    // Apply Reverb
+    reverb_block(out, frames);
 
     // Apply DC cut filter to the master output
-    // Corrected DC cut logic for stereo:
-    processed_signal.ch.left = fp_mul(HPF_ALPHA, (processed_signal.ch.left + master_state.dc_cut.prev_out.ch.left - master_state.dc_cut.prev_in.ch.left));
-    processed_signal.ch.right = fp_mul(HPF_ALPHA, (processed_signal.ch.right + master_state.dc_cut.prev_out.ch.right - master_state.dc_cut.prev_in.ch.right));
+    stereo_t prev_in = master_state.dc_cut.prev_in;
+    stereo_t prev_out = master_state.dc_cut.prev_out;
+    for (size_t n = 0; n < frames; n++)
+    {
+        // Store signal before DC cut for prev_in
+        stereo_t signal_before_dc_cut = out[n];
+
+        out[n].ch.left = fp_sat((HPF_ALPHA * (out[n].ch.left + prev_out.ch.left - prev_in.ch.left)) >> 15);
+        out[n].ch.right = fp_sat((HPF_ALPHA * (out[n].ch.right + prev_out.ch.right - prev_in.ch.right)) >> 15);
+
+        prev_in = signal_before_dc_cut;
+        prev_out = out[n];
+    }
 
     // Update DC cut state
-    master_state.dc_cut.prev_in.ch.left = signal_before_dc_cut.ch.left;
-    master_state.dc_cut.prev_in.ch.right = signal_before_dc_cut.ch.right;
-    master_state.dc_cut.prev_out.ch.left = processed_signal.ch.left;
-    master_state.dc_cut.prev_out.ch.right = processed_signal.ch.right;
+    master_state.dc_cut.prev_in = prev_in;
+    master_state.dc_cut.prev_out = prev_out;
+
+    // Voices whose envelope ended in this block go back to the allocator
+    while (active != 0)
+    {
+        int i = VOICE_MASK_FIRST(active);
+        active &= active - 1;
+        if (vs[i].env.state == IDLE)
+        {
+            voice_set_idle(&vs[i]);
+        }
+    }
+}
+
+// The only entry point that touches the synthesizer state once the output runs: MIDI events reach
+// it through the event buffer, whose consumer side is used from here alone.
+void render_block(stereo_t *out, size_t frames)
+{
+    uint32_t start = time_us_32();
+
+    // Split long requests so the per-block scratch buffers stay on the stack,
+    // and at every frame a MIDI event is scheduled for
+    while (frames > 0)
+    {
+        size_t n = frames < MAX_RENDER_BLOCK_FRAMES ? frames : MAX_RENDER_BLOCK_FRAMES;
+        n = synthesizer_apply_events(n, start);
+        master_block(voice_state, out, n);
+        render_frame += n;
+        out += n;
+        frames -= n;
+    }
+}
 
-    return processed_signal;
+// Render without applying MIDI events or moving the render clock, for measurements before the output
+// starts. Queued events stay in the buffer for render_block().
+void render_block_unscheduled(stereo_t *out, size_t frames)
+{
+    while (frames > 0)
+    {
+        size_t n = frames < MAX_RENDER_BLOCK_FRAMES ? frames : MAX_RENDER_BLOCK_FRAMES;
+        master_block(voice_state, out, n);
+        out += n;
+        frames -= n;
+    }
+}
+
+// Restart the render clock at frame 0, to match audio_output_frame() when the output starts
+void synthesizer_reset_clock()
+{
+    render_frame = 0;
 }
 
 // pitch_bend
@@ -708,18 +1081,7 @@ void handle_pitch_bend(int8_t channel, uint8_t lsb, uint8_t msb)
     {
         uint16_t pitch_bend_value = (lsb | (msb << 7));
         channel_state[channel].pitch_bend.range = pitch_bend_value;
-
-        q8_t new_pb_factor = get_interpolated_pitch_bend_factor(
-            channel_state[channel].pitch_bend.sensitivity,
-            pitch_bend_value);
-
-        for (int i = 0; i < MAX_VOICE_NUM; i++)
-        {
-            if (voice_state[i].assigned_channel_num == channel && voice_state[i].env.state != IDLE)
-            {
-                voice_state[i].pb.factor = new_pb_factor;
-            }
-        }
+        channel_update_pitch(channel);
     }
 }
 
@@ -744,11 +1106,12 @@ void handle_sustain_pedal(int8_t channel, uint8_t value)
         else // Sustain off
         {
             channel_state[channel].is_hold_on = false;
-            for (int i = 0; i < MAX_VOICE_NUM; i++)
+            voice_mask_t active = channel_voice_mask[channel];
+            while (active != 0)
             {
-                if (voice_state[i].assigned_channel_num == channel &&
-                    voice_state[i].env.state != IDLE &&
-                    voice_state[i].env.is_note_off_received == true)
+                int i = VOICE_MASK_FIRST(active);
+                active &= active - 1;
+                if (voice_state[i].env.is_note_off_received == true)
                 {
                     voice_state[i].env.state = RELEASE; // Transition to RELEASE state
                 }
@@ -763,6 +1126,7 @@ void handle_volume_control(int8_t channel, uint8_t value)
     if (channel >= 0 && channel < MAX_CHANNEL_NUM)
     {
         channel_state[channel].volume = float_to_fp((float)value / 127.0f * 0.2);
+        channel_update_gains(channel);
     }
 }
 
@@ -772,6 +1136,7 @@ void handle_expression_control(int8_t channel, uint8_t value)
     if (channel >= 0 && channel < MAX_CHANNEL_NUM)
     {
         channel_state[channel].expression = value;
+        channel_update_gains(channel);
     }
 }
 
@@ -781,6 +1146,7 @@ void handle_pan_control(int8_t channel, uint8_t value)
     if (channel >= 0 && channel < MAX_CHANNEL_NUM)
     {
         channel_state[channel].pan = value;
+        channel_update_gains(channel);
     }
 }
 
@@ -791,12 +1157,13 @@ void handle_modulation(int8_t channel, uint8_t value)
     {
         channel_state[channel].mod.depth = value; // Set channel modulation depth
         // Apply the new modulation depth to all active voices on this channel
-        for (int i = 0; i < MAX_VOICE_NUM; i++)
+        voice_mask_t active = channel_voice_mask[channel];
+        while (active != 0)
         {
-            if (voice_state[i].assigned_channel_num == channel && voice_state[i].env.state != IDLE)
-            {
-                voice_state[i].vibrato.depth = channel_state[channel].mod.depth;
-            }
+            int i = VOICE_MASK_FIRST(active);
+            active &= active - 1;
+            voice_state[i].vibrato.depth = channel_state[channel].mod.depth;
+            voice_select_kernel(&voice_state[i]); // Vibrato may have been switched on or off
         }
     }
 }
@@ -841,48 +1208,43 @@ void handle_stop_event()
 // reset_event
 void handle_reset_event()
 {
-    midi_buffer_init();
+    midi_buffer_flush();
     init_master();
-    for (int i = 0; i < MAX_VOICE_NUM; i++)
-    {
-        voice_state[i].env.state = IDLE;
-    }
     gpio_put(PICO_DEFAULT_LED_PIN, 0);
 }
 
 // All Notes Off/Reset Controllers
 void handle_all_notes_off(int8_t channel, uint8_t controller)
 {
-    // For All Notes Off type messages, affect all voices or specific channel voices
-    for (int i = 0; i < MAX_VOICE_NUM; i++)
+    if (channel < 0 || channel >= MAX_CHANNEL_NUM)
     {
-        // Check if the CC message is channel-specific.
-        // GM standard All Notes Off (0x7B) is channel-specific.
-        // 0x78 (All Sound Off) is also channel-specific.
-        if (voice_state[i].assigned_channel_num == channel)
-        {
-            voice_state[i].env.state = RELEASE; // More graceful than IDLE
-        }
+        return;
+    }
+
+    // GM standard All Notes Off (0x7B) and All Sound Off (0x78) are channel-specific.
+    voice_mask_t active = channel_voice_mask[channel];
+    while (active != 0)
+    {
+        int i = VOICE_MASK_FIRST(active);
+        active &= active - 1;
+        voice_state[i].env.state = RELEASE; // More graceful than IDLE
     }
 
     if (controller == 0x79)
     { // Reset All Controllers
         // Reset controllers for the specific channel
-        if (channel >= 0 && channel < MAX_CHANNEL_NUM)
+        init_channel(channel); // Initialize only the specified channel
+        active = channel_voice_mask[channel];
+        while (active != 0)
         {
-            init_channel(channel); // Initialize only the specified channel
-            for (int i = 0; i < MAX_VOICE_NUM; i++)
-            {
-                if (voice_state[i].assigned_channel_num == channel && voice_state[i].env.state != IDLE)
-                {
-                    voice_state[i].pb.factor = get_interpolated_pitch_bend_factor(
-                        channel_state[channel].pitch_bend.sensitivity,
-                        channel_state[channel].pitch_bend.range);
-                    voice_state[i].vibrato.depth = 0; // Reset depth for active voices
-                    voice_state[i].tone = tone_gm[0]; // Reset tone to default
-                }
-            }
+            int i = VOICE_MASK_FIRST(active);
+            active &= active - 1;
+            voice_state[i].vibrato.depth = 0; // Reset depth for active voices
+            voice_state[i].tone = tone_gm[0]; // Reset tone to default
+            voice_select_kernel(&voice_state[i]);
         }
+        channel_update_pitch(channel); // Pitch bend and tuning were reset
+        channel_update_gains(channel); // Volume, expression, pan and output gain were reset
     }
 }
 
@@ -948,6 +1310,24 @@ void handle_rpn_nrpn(int8_t channel, bool is_nrpn, uint16_t parameter, uint16_t
                     channel_state[channel].tone.env.sustain_level = v_MSB;
                 }
             }
+            else if (p_LSB == 2) // Set decay/release curve
+            {
+                if (v_MSB <= ENV_CURVE_EXPONENTIAL)
+                {
+                    channel_state[channel].tone.env.curve = v_MSB;
+                }
+            }
+            break;
+        case 8:
+            if (p_LSB == 0) // Set maximum voices (0 for no limit)
+            {
+                voice_alloc_set_max_voices(channel, v_MSB);
+            }
+            else if (p_LSB == 1) // Set reserved voices
+            {
+                voice_alloc_set_reserved_voices(channel, v_MSB);
+            }
+            break;
 
         default:
             break;
@@ -958,30 +1338,25 @@ void handle_rpn_nrpn(int8_t channel, bool is_nrpn, uint16_t parameter, uint16_t
     {
         switch (parameter)
         {
-        // RPN 0: pitch_bend_sensitivity
+        // RPN 0: pitch_bend_sensitivity (MSB semitones, LSB cents)
         case 0:
-            if (value <= 24)
+            if (v_MSB <= 24 && v_LSB <= 99)
             { // max ±24 semitones
-                channel_state[channel].pitch_bend.sensitivity = value;
-                // Update all active voices on this channel
-                for (int i = 0; i < MAX_VOICE_NUM; i++)
-                {
-                    if (voice_state[i].assigned_channel_num == channel && voice_state[i].env.state != IDLE)
-                    {
-                        voice_state[i].pb.factor = get_interpolated_pitch_bend_factor(
-                            value,
-                            channel_state[channel].pitch_bend.range);
-                    }
-                }
+                channel_state[channel].pitch_bend.sensitivity = v_MSB * 100 + v_LSB;
+                channel_update_pitch(channel);
             }
             break;
 
-        // RPN 1: master fine tuning
+        // RPN 1: channel fine tuning (8192 is A440, ±100 cents)
         case 1:
+            channel_state[channel].tuning.fine = (int16_t)value - 8192;
+            channel_update_pitch(channel);
             break;
 
-        // RPN 2: master coarse tuning
+        // RPN 2: channel coarse tuning (MSB 64 is A440, ±64 semitones)
         case 2:
+            channel_state[channel].tuning.coarse = (int8_t)(v_MSB - 64);
+            channel_update_pitch(channel);
             break;
 
         default:
@@ -990,6 +1365,38 @@ void handle_rpn_nrpn(int8_t channel, bool is_nrpn, uint16_t parameter, uint16_t
     }
 }
 
+// Data increment/decrement: step the selected RPN by one unit from its current value (one cent of pitch bend
+// sensitivity, one step of fine tuning, one semitone of coarse tuning). Other parameters are left alone,
+// their current values are not kept in a form that can be stepped.
+static void handle_rpn_step(int8_t channel, int step)
+{
+    uint16_t parameter = (channel_state[channel].nrpn_rpn.rpn_msb << 7) | channel_state[channel].nrpn_rpn.rpn_lsb;
+    int32_t value;
+    switch (parameter)
+    {
+    case 0: // Cents, 0 to 24 semitones 99 cents
+        value = channel_state[channel].pitch_bend.sensitivity + step;
+        value = (value < 0) ? 0 : (value > 2499) ? 2499 : value;
+        handle_rpn_nrpn(channel, false, 0, (uint16_t)(((value / 100) << 7) | (value % 100)));
+        break;
+
+    case 1: // 14-bit value, 8192 is A440
+        value = channel_state[channel].tuning.fine + 8192 + step;
+        value = (value < 0) ? 0 : (value > 16383) ? 16383 : value;
+        handle_rpn_nrpn(channel, false, 1, (uint16_t)value);
+        break;
+
+    case 2: // MSB, 64 is A440
+        value = channel_state[channel].tuning.coarse + 64 + step;
+        value = (value < 0) ? 0 : (value > 127) ? 127 : value;
+        handle_rpn_nrpn(channel, false, 2, (uint16_t)(value << 7));
+        break;
+
+    default:
+        break;
+    }
+}
+
 void handle_control_change(int8_t channel, uint8_t controller, uint8_t value)
 {
     if (channel < 0 || channel >= MAX_CHANNEL_NUM)
@@ -1101,56 +1508,10 @@ void handle_control_change(int8_t channel, uint8_t controller, uint8_t value)
         return;
 
     case 0x60: // data increment (96)
-        if (channel_state[channel].nrpn_rpn.param_type != PARAM_TYPE_NONE)
-        {
-            // get current NRPN/RPN parameter type and number
-            bool is_nrpn = (channel_state[channel].nrpn_rpn.param_type == PARAM_TYPE_NRPN);
-            uint16_t param_num;
-
-            if (is_nrpn)
-            {
-                param_num = (channel_state[channel].nrpn_rpn.nrpn_msb << 7) |
-                            channel_state[channel].nrpn_rpn.nrpn_lsb;
-            }
-            else
-            {
-                param_num = (channel_state[channel].nrpn_rpn.rpn_msb << 7) |
-                            channel_state[channel].nrpn_rpn.rpn_lsb;
-            }
-
-            // add 1 to the current value (implementation-dependent)
-            uint16_t current_value = 0; // get current value logic
-            uint16_t new_value = current_value + 1;
-
-            // replace the current value with the new value
-            handle_rpn_nrpn(channel, is_nrpn, param_num, new_value);
-        }
-        return;
-
     case 0x61: // data decrement (97)
-        if (channel_state[channel].nrpn_rpn.param_type != PARAM_TYPE_NONE)
+        if (channel_state[channel].nrpn_rpn.param_type == PARAM_TYPE_RPN)
         {
-            // get current NRPN/RPN parameter type and number
-            bool is_nrpn = (channel_state[channel].nrpn_rpn.param_type == PARAM_TYPE_NRPN);
-            uint16_t param_num;
-
-            if (is_nrpn)
-            {
-                param_num = (channel_state[channel].nrpn_rpn.nrpn_msb << 7) |
-                            channel_state[channel].nrpn_rpn.nrpn_lsb;
-            }
-            else
-            {
-                param_num = (channel_state[channel].nrpn_rpn.rpn_msb << 7) |
-                            channel_state[channel].nrpn_rpn.rpn_lsb;
-            }
-
-            // subtract 1 from the current value (implementation-dependent)
-            uint16_t current_value = 0; // get current value logic
-            uint16_t new_value = current_value - 1;
-
-            // replace the current value with the new value
-            handle_rpn_nrpn(channel, is_nrpn, param_num, new_value);
+            handle_rpn_step(channel, (controller == 0x60) ? 1 : -1);
         }
         return;
 
@@ -1227,45 +1588,79 @@ void handle_control_change(int8_t channel, uint8_t controller, uint8_t value)
     }
 }
 
-void synthesizer_task()
+// Apply one MIDI event to the synthesizer state
+static void synthesizer_dispatch(midi_t *midi)
 {
-    if (!midi_buffer_empty())
+    if (midi->event == NOTE_ON && midi->msg[2] == 0)
     {
-        midi_t midi = midi_buffer_pop();
+        midi->event = NOTE_OFF; // Velocity 0 is a note off, as running status streams send them
+    }
 
-        switch (midi.event)
-        {
-        case NOTE_ON:
-            note_on(&midi, voice_state);
-            break;
+    switch (midi->event)
+    {
+    case NOTE_ON:
+        note_on(midi, voice_state);
+        break;
 
-        case NOTE_OFF:
-            note_off(&midi, voice_state);
-            break;
+    case NOTE_OFF:
+        note_off(midi, voice_state);
+        break;
 
-        case PITCH_BEND:
-            handle_pitch_bend(midi.ch, midi.msg[1], midi.msg[2]);
-            break;
+    case PITCH_BEND:
+        handle_pitch_bend(midi->ch, midi->msg[1], midi->msg[2]);
+        break;
 
-        case PROGRAM_CHANGE:
-            handle_program_change(midi.ch, midi.msg[1]);
-            break;
+    case PROGRAM_CHANGE:
+        handle_program_change(midi->ch, midi->msg[1]);
+        break;
 
-        case CONTROL_CHANGE:
-            handle_control_change(midi.ch, midi.msg[1], midi.msg[2]);
-            break;
+    case CONTROL_CHANGE:
+        handle_control_change(midi->ch, midi->msg[1], midi->msg[2]);
+        break;
 
-        case STOP:
-            handle_stop_event();
-            break;
+    case STOP:
+        handle_stop_event();
+        break;
 
-        case RESET:
-            handle_reset_event();
-            break;
+    case RESET:
+        handle_reset_event();
+        break;
 
-        default:
-            // Unknown MIDI event
+    default:
+        // Unknown MIDI event
+        break;
+    }
+}
+
+// Apply the queued MIDI events that are due at the next frame to render, MIDI_LATENCY_FRAMES after
+// they arrived. Stale controller values among them are dropped first. Returns how many of the next frames can be rendered before another event is due.
+// Events that are already late are applied at once and counted. Once MIDI_DRAIN_BUDGET_US has
+// passed since start, the rest waits for the next call so a large burst cannot hold up the refill.
+static size_t synthesizer_apply_events(size_t frames, uint32_t start)
+{
+    midi_t midi;
+    midi_buffer_coalesce(render_frame - MIDI_LATENCY_FRAMES + 1); // Backlog: events due at this frame or before
+    while (midi_buffer_peek(&midi))
+    {
+        int32_t due = (int32_t)(midi.timestamp + MIDI_LATENCY_FRAMES - render_frame);
+        if (due > MIDI_LATENCY_FRAMES)
+        {
+            due = 0; // Stamped ahead of the render clock (output not started yet), play it now
+        }
+        if (due > 0)
+        {
+            return (size_t)due < frames ? (size_t)due : frames;
+        }
+        if (time_us_32() - start >= MIDI_DRAIN_BUDGET_US)
+        {
             break;
         }
+        midi_buffer_pop(&midi);
+        if (due < 0)
+        {
+            midi_buffer_stats.late++;
+        }
+        synthesizer_dispatch(&midi);
     }
-}
\ No newline at end of file
+    return frames;
+}
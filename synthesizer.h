@@ -8,19 +8,46 @@
 #include <math.h>
 #include "hardware/interp.h"
 #include "fp.h"
-#include "wave_table.h"
+#include "oscillator.h"
 #include "midi.h"
-#include "pitch_bend_table_interpolated.h"
 #include "vibrato_table.h"
 #include "pcm_table.h"
 
 #define FS (40e3f)
-#define TABLE_LENGTH_q8 (TABLE_LENGTH << 8)
 #define MAX_VOICE_NUM 20
 #define MAX_CHANNEL_NUM 16
+#define DRUM_CHANNEL 9    // Plays PCM drums from its own pool instead of the voices
+#define DRUM_VOICE_NUM 8  // Drum hits that can sound at once
 
-#define MAX_SASTAIN_LENGTH 7 // Maximum sustain length in seconds
-#define ENV_COUNTER_THRESHOLD ((uint32_t)(MAX_SASTAIN_LENGTH * FS / 127.0f / 128.0f))
+// Bitmask with one bit per voice, used to index the active voices of a channel
+#if MAX_VOICE_NUM <= 32
+typedef uint32_t voice_mask_t;
+#define VOICE_MASK_FIRST(mask) __builtin_ctz(mask)
+#else
+typedef uint64_t voice_mask_t;
+#define VOICE_MASK_FIRST(mask) __builtin_ctzll(mask)
+#endif
+#define VOICE_MASK_BIT(i) ((voice_mask_t)1 << (i))
+
+#define AUDIO_BLOCK_SIZE 32         // Frames rendered per audio callback
+#ifndef AUDIO_ON_CORE1
+#define AUDIO_ON_CORE1 1 // Render and play audio on core1, leaving USB and MIDI input to core0
+#endif
+#ifndef RENDER_SPLIT
+#define RENDER_SPLIT AUDIO_ON_CORE1 // Core0 renders part of the voices for core1 (see render_split.h)
+#endif
+#define MIDI_DRAIN_BUDGET_US 200    // Time render_block() may spend applying queued MIDI events per call
+#ifndef MIDI_LATENCY_FRAMES
+#define MIDI_LATENCY_FRAMES (3 * AUDIO_BLOCK_SIZE) // Arrival to sound, at least the two output buffers plus loop jitter
+#endif
+#define MAX_RENDER_BLOCK_FRAMES 128 // Longest block rendered in one pass (sizes the scratch buffers)
+
+#define MAX_SASTAIN_LENGTH 7                                      // Maximum sustain length in seconds
+#define ENV_TICK_SECONDS (MAX_SASTAIN_LENGTH / 127.0f / 128.0f)   // Duration of one step of the envelope time parameters
+#define ENV_CONTROL_SHIFT 4                                       // log2 of ENV_CONTROL_FRAMES
+#define ENV_CONTROL_FRAMES (1 << ENV_CONTROL_SHIFT)               // Frames between envelope and vibrato updates
+#define ENV_LEVEL_MAX ((127 * 128) << 16)                         // Full scale envelope level (amplitude units in the upper 16 bits)
+#define ENV_EXP_END_LEVEL (1 << 16)                               // Exponential segments end below one amplitude unit
 
 #define HPF_CUTOFF_FREQ 2.0f
 #define HPF_RC (1.0f / (2.0f * M_PI * HPF_CUTOFF_FREQ))
@@ -82,6 +109,12 @@ typedef enum
     IDLE,
 } env_state_t;
 
+typedef enum
+{
+    ENV_CURVE_LINEAR = 0,      // Linear decay and release
+    ENV_CURVE_EXPONENTIAL = 1, // Exponential decay and release
+} env_curve_t;
+
 typedef struct
 {
     struct
@@ -102,13 +135,19 @@ typedef struct
         int8_t sustain_level; // Sustain level
         int8_t sustain_rate;  // Sustain rate
         int8_t release_time;  // Release time
+        int8_t curve;         // Decay/release curve (env_curve_t)
     } env;                    // Envelope parameters
     int8_t output_gain;       // Output gain
 } tone_t;
 
 #include "tone.h"
 
-typedef struct
+typedef struct voice_state voice_state_t;
+
+// Renders up to frames samples of a voice into out, returns the number rendered (fewer if the voice went idle)
+typedef size_t (*voice_kernel_t)(voice_state_t *vs, fp_t *out, size_t frames);
+
+struct voice_state
 {
     int8_t assigned_channel_num;
     tone_t tone;
@@ -116,36 +155,46 @@ typedef struct
     int8_t velocity; // Velocity (0 to 127)
     struct
     {
-        wave_type_t type;  // Wave type
-        q8_t increment;    // Phase increment for the oscillator
-        q8_t read_pointer; // Read pointer for the oscillator waveform
-    } osc1;                // First oscillator state
+        wave_type_t type;            // Wave type
+        const fp_t *table;           // Wave table read by the oscillator (band-limited for the pitch)
+        phase_t increment;           // Phase increment for the note with pitch bend and tuning applied
+        phase_t read_pointer;        // Phase of the oscillator waveform
+        phase_t effective_increment; // Increment with vibrato applied
+        int32_t increment_slope;     // Per-sample change of effective_increment during vibrato
+        uint32_t noise_state;        // Generator state for the NOISE wave
+    } osc1;                          // First oscillator state
 
     struct
     {
-        q8_t increment;    // Phase increment for the second oscillator
-        q8_t read_pointer; // Read pointer for the second oscillator waveform
-    } osc2;                // Second oscillator state
+        phase_t increment;           // Phase increment for the second oscillator
+        phase_t read_pointer;        // Phase of the second oscillator waveform
+        phase_t effective_increment; // Increment with vibrato applied
+        int32_t increment_slope;     // Per-sample change of effective_increment during vibrato
+    } osc2;                          // Second oscillator state
 
     struct
     {
-        q8_t factor; // Pitch bend factor for the oscillator
-    } pb;
+        phase_t increment;    // Phase increment of the vibrato LFO
+        phase_t read_pointer; // Phase of the vibrato LFO
+        q8_t factor;          // Vibrato factor
+        int8_t depth;         // Depth of the vibrato
+        int8_t freq;          // Speed of the vibrato
+    } vibrato;                // Vibrato parameters
 
     struct
     {
-        q8_t increment;
-        q8_t read_pointer; // Read pointer for the vibrato waveform
-        q8_t factor;       // Vibrato factor
-        int8_t depth;      // Depth of the vibrato
-        int8_t freq;       // Speed of the vibrato
-    } vibrato;             // Vibrato parameters
-
-    struct
-    {
-        fp_t amplitude;            // Amplitude of the oscillator waveform
+        int32_t level;             // Current level (amplitude units in the upper 16 bits)
+        int32_t target;            // Level at the next control update
+        int32_t slope;             // Per-sample level change towards target
+        uint32_t countdown;        // Frames left until the next control update
+        int32_t attack_step;       // Level change per control period in ATTACK
+        int32_t decay_step;        // Level change per control period in linear DECAY
+        int32_t decay_coef;        // Q30 factor per control period in exponential DECAY (0 = linear)
+        int32_t sustain_level;     // Level where DECAY ends
+        int32_t sustain_step;      // Level change per control period in SUSTAIN
+        int32_t release_step;      // Level change per control period in linear RELEASE
+        int32_t release_coef;      // Q30 factor per control period in exponential RELEASE (0 = linear)
         env_state_t state;         // Current state of the envelope
-        uint32_t counter;          // Counter for envelope timing (based on fs)
         bool is_note_off_received; // Flag to indicate if a note off event has been received
     } env;                         // Envelope state
 
@@ -155,9 +204,19 @@ typedef struct
         fp_t prev_in;  // Previous input value for DC cut
     } dc_cut;          // DC cut parameters
 
+    struct
+    {
+        int32_t left;         // Current left gain (fp_t in the upper 16 bits)
+        int32_t right;        // Current right gain (fp_t in the upper 16 bits)
+        int32_t target_left;  // Left gain reached at the end of the next block
+        int32_t target_right; // Right gain reached at the end of the next block
+    } gain;                   // Volume, expression, pan, velocity and output gain folded together
+
     fp_t amplitude;                     // Current amplitude of the voice
-    uint32_t pcm_initial_delay_counter; // PCM initial delay counter
-} voice_state_t;
+    voice_kernel_t kernel;              // Render kernel for the current tone, vibrato and ring modulation settings
+    uint8_t kernel_index;               // Index of the kernel in voice_kernels (noise << 2 | vibrato << 1 | ring modulation)
+    uint16_t cost;                      // Measured render cycles per frame, running average
+};
 
 typedef enum
 {
@@ -188,10 +247,16 @@ typedef struct
     uint8_t expression; // expression (0-127)
     struct
     {
-        int8_t sensitivity; // sensitivity of pitch bend (0-24)
-        uint16_t range;     // pitch bend range (0-16383)
+        uint16_t sensitivity; // sensitivity of pitch bend in cents (0-2499)
+        uint16_t range;       // pitch bend range (0-16383)
     } pitch_bend;
     struct
+    {
+        int16_t fine;  // fine tuning (-8192-8191 for -100 to +100 cents)
+        int8_t coarse; // coarse tuning in semitones (-64-63)
+    } tuning;
+    pitch_t pitch_offset; // pitch bend and tuning added to the note pitch
+    struct
     {
         uint8_t depth; // depth of modulation (0-127)
         uint8_t freq;  // frequency of modulation (0-127)
@@ -214,18 +279,22 @@ extern voice_state_t voice_state[MAX_VOICE_NUM];
 extern ch_state_t channel_state[MAX_CHANNEL_NUM];
 extern master_state_t master_state;
 extern reverb_state_t reverb_state;
+extern voice_mask_t channel_voice_mask[MAX_CHANNEL_NUM]; // Active (non-IDLE) voices of each channel
 
+stereo_t stereo_gain(int8_t ch, uint8_t velocity, uint8_t output_gain, int makeup_shift);
 void set_voice_state(voice_state_t *vs, tone_t *tone, int8_t ch, int8_t note, int8_t velocity);
-void voice(voice_state_t *vs);
 void init_channel(int8_t ch_to_init);
+void init_voices();
+void init_envelope_tables();
 void init_master();
 void init_reverb();
-stereo_t reverb(stereo_t input);
+void reverb_block(stereo_t *buffer, size_t frames);
 void note_on(midi_t *midi, voice_state_t *vs);
 void note_off(midi_t *midi, voice_state_t *vs);
-stereo_t channel(voice_state_t *vs, int8_t ch);
-stereo_t master(voice_state_t *vs);
-void synthesizer_task();
+void mix_voices(voice_state_t *vs, voice_mask_t voices, stereo_t *out, size_t frames);
+void render_block(stereo_t *out, size_t frames);
+void render_block_unscheduled(stereo_t *out, size_t frames);
+void synthesizer_reset_clock();
 void handle_rpn_nrpn(int8_t channel, bool is_nrpn, uint16_t parameter, uint16_t value);
 
 #endif
\ No newline at end of file
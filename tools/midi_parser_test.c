@@ -0,0 +1,104 @@
+// Host test for the DIN MIDI byte parser.
+//
+// Feeds byte streams as recorded from keyboards and sequencers to midi_parser_byte() and compares the
+// messages that come out with the expected ones.
+//
+// Build and run from this directory:
+//   gcc -std=gnu11 -O2 -Wall -I.. midi_parser_test.c ../midi_parser.c -o midi_parser_test && ./midi_parser_test
+
+#include <stdio.h>
+#include <string.h>
+#include "midi_parser.h"
+
+#define MAX_TEST_MESSAGES 16
+
+typedef struct
+{
+    const char *name;
+    const uint8_t *bytes;
+    size_t length;
+    uint8_t expected[MAX_TEST_MESSAGES][3];
+    int expected_count;
+} parser_test_t;
+
+#define STREAM(...) (const uint8_t[]){__VA_ARGS__}, sizeof((const uint8_t[]){__VA_ARGS__})
+
+static const parser_test_t tests[] = {
+    {
+        // A keyboard playing a chord and releasing it with velocity 0 note ons under one status byte
+        "running status notes",
+        STREAM(0x90, 0x3c, 0x64, 0x40, 0x5a, 0x43, 0x50, 0x3c, 0x00, 0x40, 0x00, 0x43, 0x00),
+        {{0x90, 0x3c, 0x64}, {0x90, 0x40, 0x5a}, {0x90, 0x43, 0x50}, {0x90, 0x3c, 0x00}, {0x90, 0x40, 0x00}, {0x90, 0x43, 0x00}},
+        6,
+    },
+    {
+        // Clock and active sensing from a sequencer landing inside note ons, before and between the data bytes
+        "real-time bytes inside a note on",
+        STREAM(0x91, 0xf8, 0x30, 0x7f, 0x32, 0xf8, 0x7f, 0xfe, 0x30, 0xf8, 0x00),
+        {{0xf8, 0x00, 0x00}, {0x91, 0x30, 0x7f}, {0xf8, 0x00, 0x00}, {0x91, 0x32, 0x7f}, {0xfe, 0x00, 0x00}, {0xf8, 0x00, 0x00}, {0x91, 0x30, 0x00}},
+        7,
+    },
+    {
+        // GS reset SysEx with a clock inside it. It cancels the running status, so the data bytes after
+        // it are dropped until the next status byte.
+        "SysEx followed by running status data",
+        STREAM(0xb0, 0x07, 0x64, 0xf0, 0x41, 0x10, 0x42, 0x12, 0xf8, 0x40, 0x00, 0x7f, 0x00, 0x41, 0xf7,
+               0x07, 0x50, 0xb0, 0x07, 0x50, 0x0a, 0x40),
+        {{0xb0, 0x07, 0x64}, {0xf8, 0x00, 0x00}, {0xb0, 0x07, 0x50}, {0xb0, 0x0a, 0x40}},
+        4,
+    },
+    {
+        // Program change and pitch bend under running status, then a song position pointer and stray data
+        "one and two byte messages and system common",
+        STREAM(0xc2, 0x05, 0x06, 0xe2, 0x00, 0x40, 0x7f, 0x7f, 0xf2, 0x10, 0x02, 0x3c, 0x00, 0xf6, 0xf4, 0x01),
+        {{0xc2, 0x05, 0x00}, {0xc2, 0x06, 0x00}, {0xe2, 0x00, 0x40}, {0xe2, 0x7f, 0x7f}, {0xf2, 0x10, 0x02}, {0xf6, 0x00, 0x00}},
+        6,
+    },
+};
+
+static int run_test(const parser_test_t *test)
+{
+    midi_parser_t parser;
+    midi_parser_init(&parser);
+
+    uint8_t received[MAX_TEST_MESSAGES][3];
+    int count = 0;
+    for (size_t i = 0; i < test->length; i++)
+    {
+        uint8_t msg[3];
+        if (midi_parser_byte(&parser, test->bytes[i], msg))
+        {
+            if (count < MAX_TEST_MESSAGES)
+            {
+                memcpy(received[count], msg, 3);
+            }
+            count++;
+        }
+    }
+
+    bool pass = (count == test->expected_count);
+    for (int i = 0; pass && i < count; i++)
+    {
+        pass = memcmp(received[i], test->expected[i], 3) == 0;
+    }
+
+    printf("%s: %s\n", pass ? "pass" : "FAIL", test->name);
+    if (!pass)
+    {
+        for (int i = 0; i < count && i < MAX_TEST_MESSAGES; i++)
+        {
+            printf("  got %02x %02x %02x\n", received[i][0], received[i][1], received[i][2]);
+        }
+    }
+    return pass ? 0 : 1;
+}
+
+int main(void)
+{
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+    {
+        failures += run_test(&tests[i]);
+    }
+    return failures != 0;
+}
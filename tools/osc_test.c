@@ -0,0 +1,106 @@
+// Host test for the table oscillator streams.
+//
+// Checks that osc_stream_*() (the C path used off the device) and a model of the SIO interpolator set up
+// by init_oscillator_interp() read the same table entries with the same phases as direct osc_table_read()
+// calls, for a range of increments including increment changes in the middle of a stream (vibrato).
+//
+// Build and run from this directory:
+//   gcc -std=gnu11 -O2 -Wall -I.. osc_test.c ../oscillator.c ../wave_table.c -lm -o osc_test && ./osc_test
+
+#include <stdio.h>
+#include "oscillator.h"
+
+#if OSC_USE_INTERP
+#error "Build the oscillator test on a host, where the streams use the C path"
+#endif
+
+#define TEST_FRAMES 4096
+
+// Interpolator lane 0 as configured by init_oscillator_interp(): ADD_RAW, shift PHASE_INDEX_SHIFT - 1 and
+// mask bits 1 to TABLE_LENGTH_BITS. Lane 1 adds nothing, so FULL = BASE2 + the masked lane 0 value.
+typedef struct
+{
+    uint32_t accum0;
+    uint32_t base0;
+    uintptr_t base2;
+} interp_model_t;
+
+static uintptr_t interp_model_pop_full(interp_model_t *interp)
+{
+    uint32_t mask = ((1u << TABLE_LENGTH_BITS) - 1) << 1;
+    uintptr_t full = interp->base2 + ((interp->accum0 >> (PHASE_INDEX_SHIFT - 1)) & mask);
+    interp->accum0 += interp->base0; // ADD_RAW: the lane 0 result written back is ACCUM0 + BASE0
+    return full;
+}
+
+static fp_t interp_model_next(interp_model_t *interp)
+{
+    phase_t phase = interp->accum0;
+    const fp_t *entry = (const fp_t *)interp_model_pop_full(interp);
+    return osc_table_read(entry, phase);
+}
+
+// Render one stream three ways, changing the increment by slope every frame, and count mismatches
+static int test_stream(const fp_t *table, phase_t phase, phase_t increment, int32_t slope)
+{
+    osc_stream_t stream;
+    osc_stream_start(&stream, 0, table, phase, increment);
+    interp_model_t interp = {phase, increment, (uintptr_t)table};
+    phase_t ref_phase = phase;
+    phase_t ref_increment = increment;
+    int errors = 0;
+
+    for (int n = 0; n < TEST_FRAMES; n++)
+    {
+        fp_t expected = osc_table_read(&table[ref_phase >> PHASE_INDEX_SHIFT], ref_phase);
+        fp_t c_path = osc_stream_next(&stream);
+        fp_t interp_path = interp_model_next(&interp);
+        if (c_path != expected || interp_path != expected)
+        {
+            if (errors++ < 4)
+            {
+                printf("  increment %08x frame %d: expected %d, C %d, interpolator %d\n",
+                       (unsigned)increment, n, expected, c_path, interp_path);
+            }
+        }
+        ref_phase += ref_increment;
+
+        ref_increment += slope;
+        osc_stream_set_increment(&stream, ref_increment);
+        interp.base0 = ref_increment;
+    }
+
+    if (osc_stream_phase(&stream) != ref_phase || interp.accum0 != ref_phase)
+    {
+        printf("  increment %08x: final phase differs\n", (unsigned)increment);
+        errors++;
+    }
+    return errors;
+}
+
+int main(void)
+{
+    init_oscillator_tables();
+
+    int errors = 0;
+    int streams = 0;
+    for (int shift = 0; shift < 32; shift++)
+    {
+        for (phase_t low = 0; low < 4; low++)
+        {
+            phase_t increment = ((phase_t)1 << shift) + low * 0x12345u;
+            phase_t phase = increment * 0x9e3779b9u;
+            const fp_t *tables[] = {sin_table, osc_mipmap_table(0, increment), osc_mipmap_table(1, increment),
+                                    osc_mipmap_table(2, increment)};
+            for (int t = 0; t < 4; t++)
+            {
+                errors += test_stream(tables[t], phase, increment, 0);
+                errors += test_stream(tables[t], phase, increment, (int32_t)(increment >> 12) - 7);
+                streams += 2;
+            }
+        }
+    }
+
+    printf("%d streams of %d frames, %d mismatches\n", streams, TEST_FRAMES, errors);
+    return errors != 0;
+}
@@ -11,8 +11,8 @@ def vibrato_table(bits=16, length=256):
     # Generate a vibrato table based on MIDI LFO frequency
     num = np.arange(128)  # MIDI numbers from 0 to 127
     frequencies = np.array([midi_to_lfo_freq(i) for i in num])
-    # Q8 format conversion
-    readindex = np.int64(frequencies * 4096 / 40000 * 2**8)
+    # Phase increments for 32-bit phase accumulators (one LFO cycle spans 2**32)
+    readindex = np.int64(frequencies / 40000 * 2**32)
     print("readindex: ", readindex)
     return readindex
 
@@ -27,7 +27,7 @@ with open("vibrato_table.h", "w") as f:
     f.write("#define VIBRATO_TABLE_H\n")
     f.write('#include "fp.h"\n\n')
     f.write("#define VIBRATO_TABLE_LENGTH {}\n".format(length))
-    f.write("static const q8_t vibrato_table[] = {")
+    f.write("static const phase_t vibrato_table[] = {")
     f.write(",".join([str(x) for x in vibrato_table]))
     f.write("};\n")
     f.write("#endif // VIBRATO_TABLE_H\n")
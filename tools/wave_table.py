@@ -1,55 +1,44 @@
-import numpy as np
-
-
-def sin_table(bits=16, length=256):
-    return np.round(
-        (2 ** (bits - 1) - 1) * np.sin(np.linspace(0, 2 * np.pi, length)), 0
-    ).astype(int)
-
-
-def sawtooth_table(bits=16, length=256):
-    return np.round((2 ** (bits - 1) - 1) * (np.linspace(-1, 1, length)), 0).astype(int)
+import sys
 
-
-def triangle_table(bits=16, length=256):
-    return np.round(
-        (2 ** (bits - 1) - 1) * (np.abs(np.linspace(-2, 2, length)) - 1), 0
-    ).astype(int)
+import numpy as np
 
 
-def square_table(bits=16, length=256):
+def sin_quarter_table(bits=16, length=256):
+    # First quarter of a sine cycle of `length` samples, including the peak at length / 4
+    quarter = length // 4
     return np.round(
-        (2 ** (bits - 1) - 1) * np.sign(np.sin(np.linspace(0, 2 * np.pi, length))), 0
+        (2 ** (bits - 1) - 1) * np.sin(np.arange(quarter + 1) * 2 * np.pi / length), 0
     ).astype(int)
 
 
-def noise_table(bits=16, length=256):
-    return np.random.randint(-1 * (2 ** (bits - 1) - 1), 2 ** (bits - 1), length)
-
-
 def midi_to_frequency(midi_note):
     # Calculate the frequency corresponding to the MIDI note number
     return 440.0 * 2.0 ** ((midi_note - 69) / 12.0)
 
 
-# Generate a list of frequencies corresponding to MIDI note numbers 0 to 127
-midi_notes = np.arange(128)  # MIDI note numbers from 0 to 127
-frequencies = np.array(
-    [midi_to_frequency(note) for note in midi_notes]
-)  # Frequencies corresponding to MIDI note numbers
+# Tables for osc_pitch_increment(), which turns a pitch in 1/65536 semitones into a phase increment:
+# the increments of MIDI notes 0 to 11 scaled by 2**PITCH_SEMITONE_SHIFT, and 2**(x/12) for x from 0 to 1
+# in 2**PITCH_STEP_BITS steps as Q31. Both are uint32_t.
+PITCH_SEMITONE_SHIFT = 11
+PITCH_STEP_BITS = 6
+semitone_increments = np.round(
+    np.array([midi_to_frequency(note) for note in range(12)]) / 40000 * 2**32 * 2**PITCH_SEMITONE_SHIFT, 0
+).astype(np.int64)
+fraction_ratios = np.round(
+    2.0 ** (np.arange(2**PITCH_STEP_BITS + 1) / 2**PITCH_STEP_BITS / 12) * 2**31, 0
+).astype(np.int64)
 
 # generate the tables
+# Only a quarter of the sine cycle is stored. The firmware unfolds it at boot and sums band-limited saw,
+# square and triangle tables from it (see oscillator.c), noise comes from a xorshift generator.
+# The table length (a power of two) can be given on the command line. With OSC_INTERPOLATE enabled
+# 256 or 512 is enough, without it use 4096.
 bits = 16
-length = 4096
-sin_table = sin_table(bits, length)
-sawtooth_table = sawtooth_table(bits, length)
-triangle_table = triangle_table(bits, length)
-square_table = square_table(bits, length)
-noise_table = noise_table(bits, length)
+length = int(sys.argv[1]) if len(sys.argv) > 1 else 512
+sin_quarter_table = sin_quarter_table(bits, length)
 
-# Convert to fixed point (8-bit fractional part)
-readindex = np.int64(frequencies * length / 40000 * 2**8)
-print("readindex: ", readindex)
+# Phase increments are for 32-bit phase accumulators (one waveform cycle spans 2**32) at 40 kHz
+print("semitone increments: ", semitone_increments)
 
 # write the tables to file
 with open("wave_table.h", "w") as f:
@@ -58,47 +47,32 @@ with open("wave_table.h", "w") as f:
     f.write("#include <stdint.h>\n")
     f.write('#include "fp.h"\n')
     f.write("#define TABLE_LENGTH {}\n".format(length))
-    f.write("static const fp_t sin_table[] = {")
-    f.write(",".join([str(x) for x in sin_table]))
-    f.write("};")
-    f.write("\n")
-    f.write("static const fp_t sawtooth_table[] = {")
-    f.write(",".join([str(x) for x in sawtooth_table]))
-    f.write("};")
-    f.write("\n")
-    f.write("static const fp_t triangle_table[] = {")
-    f.write(",".join([str(x) for x in triangle_table]))
-    f.write("};")
-    f.write("\n")
-    f.write("static const fp_t square_table[] = {")
-    f.write(",".join([str(x) for x in square_table]))
-    f.write("};")
-    f.write("\n")
-    f.write("static const fp_t noise_table[] = {")
-    f.write(",".join([str(x) for x in noise_table]))
-    f.write("};")
-    f.write("\n")
-    f.write("static const q8_t increment_table[] = {")
-    f.write(",".join([str(x) for x in readindex]))
-    f.write("};")
-    f.write("\n")
-
-    f.write("#endif\\n")
+    f.write("#define TABLE_LENGTH_BITS {}\n".format(length.bit_length() - 1))
+    f.write("#define SIN_QUARTER_LENGTH (TABLE_LENGTH / 4)\n")
+    f.write("extern fp_t sin_quarter_table[SIN_QUARTER_LENGTH + 1];\n")
+    f.write("#define PITCH_SEMITONE_SHIFT {}\n".format(PITCH_SEMITONE_SHIFT))
+    f.write("#define PITCH_STEP_BITS {}\n".format(PITCH_STEP_BITS))
+    f.write("extern const uint32_t pitch_semitone_table[12];\n")
+    f.write("extern const uint32_t pitch_fraction_table[(1 << PITCH_STEP_BITS) + 1];\n")
+
+    f.write("#endif\n")
+
+# Not const, so the table is copied to SRAM at boot and oscillator reads stay off the flash cache
+with open("wave_table.c", "w") as f:
+    f.write('#include "wave_table.h"\n\n')
+    f.write("fp_t sin_quarter_table[SIN_QUARTER_LENGTH + 1] = {")
+    f.write(",".join([str(x) for x in sin_quarter_table]))
+    f.write("};\n")
+    f.write("const uint32_t pitch_semitone_table[12] = {")
+    f.write(",".join([str(x) for x in semitone_increments]))
+    f.write("};\n")
+    f.write("const uint32_t pitch_fraction_table[(1 << PITCH_STEP_BITS) + 1] = {")
+    f.write(",".join([str(x) for x in fraction_ratios]))
+    f.write("};\n")
 
 print(
     "Total size of tables: {} bytes".format(
-        sum(
-            [
-                x.nbytes
-                for x in [
-                    sin_table,
-                    sawtooth_table,
-                    triangle_table,
-                    square_table,
-                    noise_table,
-                ]
-            ]
-        )
+        len(sin_quarter_table) * 2 + (len(semitone_increments) + len(fraction_ratios)) * 4
     )
 )
-print("Tables written to wave_table.h")
+print("Tables written to wave_table.h and wave_table.c")
@@ -3,5 +3,5 @@
 #include "fp.h"
 
 #define VIBRATO_TABLE_LENGTH 128
-static const q8_t vibrato_table[] = {131,132,134,136,138,140,142,144,145,147,149,151,153,155,157,158,160,162,164,166,168,170,171,173,175,177,179,181,183,184,186,188,190,192,194,196,197,199,201,203,205,207,209,210,212,214,216,218,220,222,223,225,227,229,231,233,235,236,238,240,242,244,246,248,249,251,253,255,257,259,261,262,264,266,268,270,272,274,275,277,279,281,283,285,287,288,290,292,294,296,298,300,301,303,305,307,309,311,313,314,316,318,320,322,324,326,327,329,331,333,335,337,339,340,342,344,346,348,350,352,353,355,357,359,361,363,365,367};
+static const phase_t vibrato_table[] = {536870,544480,552089,559698,567307,574916,582526,590135,597744,605353,612962,620572,628181,635790,643399,651008,658618,666227,673836,681445,689054,696663,704273,711882,719491,727100,734709,742319,749928,757537,765146,772755,780365,787974,795583,803192,810801,818411,826020,833629,841238,848847,856457,864066,871675,879284,886893,894503,902112,909721,917330,924939,932549,940158,947767,955376,962985,970594,978204,985813,993422,1001031,1008640,1016250,1023859,1031468,1039077,1046686,1054296,1061905,1069514,1077123,1084732,1092342,1099951,1107560,1115169,1122778,1130388,1137997,1145606,1153215,1160824,1168434,1176043,1183652,1191261,1198870,1206479,1214089,1221698,1229307,1236916,1244525,1252135,1259744,1267353,1274962,1282571,1290181,1297790,1305399,1313008,1320617,1328227,1335836,1343445,1351054,1358663,1366273,1373882,1381491,1389100,1396709,1404319,1411928,1419537,1427146,1434755,1442365,1449974,1457583,1465192,1472801,1480410,1488020,1495629,1503238};
 #endif // VIBRATO_TABLE_H
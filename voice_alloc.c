@@ -0,0 +1,250 @@
+#include "voice_alloc.h"
+
+typedef struct
+{
+    int8_t prev;
+    int8_t next;
+} voice_link_t;
+
+typedef struct
+{
+    int8_t oldest;
+    int8_t newest;
+} voice_list_t;
+
+voice_alloc_stats_t voice_alloc_stats[MAX_CHANNEL_NUM];
+
+static voice_mask_t voice_free_mask;
+static int voice_free_count;
+
+// Sounding voices from oldest to newest, across all channels and per channel
+static voice_link_t age_link[MAX_VOICE_NUM];
+static voice_list_t age_list;
+static voice_link_t channel_link[MAX_VOICE_NUM];
+static voice_list_t channel_list[MAX_CHANNEL_NUM];
+
+// Voices of each (channel, note) key, newest first
+static int8_t key_head[MAX_CHANNEL_NUM][128];
+static int8_t key_next[MAX_VOICE_NUM];
+static int8_t key_channel[MAX_VOICE_NUM];
+static uint8_t key_note[MAX_VOICE_NUM];
+
+// Per-channel limits and the number of reserved voices channels are still short of
+static uint8_t channel_max_voices[MAX_CHANNEL_NUM];
+static uint8_t channel_reserved_voices[MAX_CHANNEL_NUM];
+static uint8_t channel_voice_count[MAX_CHANNEL_NUM];
+static int reserve_shortfall;
+
+static void list_append(voice_list_t *list, voice_link_t *links, int voice)
+{
+    links[voice].prev = list->newest;
+    links[voice].next = VOICE_NONE;
+    if (list->newest != VOICE_NONE)
+    {
+        links[list->newest].next = voice;
+    }
+    else
+    {
+        list->oldest = voice;
+    }
+    list->newest = voice;
+}
+
+static void list_remove(voice_list_t *list, voice_link_t *links, int voice)
+{
+    int8_t prev = links[voice].prev;
+    int8_t next = links[voice].next;
+    if (prev != VOICE_NONE)
+    {
+        links[prev].next = next;
+    }
+    else
+    {
+        list->oldest = next;
+    }
+    if (next != VOICE_NONE)
+    {
+        links[next].prev = prev;
+    }
+    else
+    {
+        list->newest = prev;
+    }
+}
+
+static inline int channel_shortfall(int ch)
+{
+    int shortfall = channel_reserved_voices[ch] - channel_voice_count[ch];
+    return shortfall > 0 ? shortfall : 0;
+}
+
+// Change the voice count of a channel and keep the reservation total in step
+static void channel_count_add(int ch, int delta)
+{
+    reserve_shortfall -= channel_shortfall(ch);
+    channel_voice_count[ch] += delta;
+    reserve_shortfall += channel_shortfall(ch);
+}
+
+void voice_alloc_init()
+{
+    voice_free_mask = 0;
+    for (int i = 0; i < MAX_VOICE_NUM; i++)
+    {
+        voice_free_mask |= VOICE_MASK_BIT(i);
+        key_next[i] = VOICE_NONE;
+    }
+    voice_free_count = MAX_VOICE_NUM;
+    age_list.oldest = VOICE_NONE;
+    age_list.newest = VOICE_NONE;
+
+    for (int ch = 0; ch < MAX_CHANNEL_NUM; ch++)
+    {
+        for (int note = 0; note < 128; note++)
+        {
+            key_head[ch][note] = VOICE_NONE;
+        }
+        channel_list[ch].oldest = VOICE_NONE;
+        channel_list[ch].newest = VOICE_NONE;
+        channel_max_voices[ch] = MAX_VOICE_NUM;
+        channel_reserved_voices[ch] = 0;
+        channel_voice_count[ch] = 0;
+        voice_alloc_stats[ch].voices_stolen = 0; // Counters start over with the song (MIDI Reset)
+        voice_alloc_stats[ch].notes_dropped = 0;
+    }
+    reserve_shortfall = 0;
+}
+
+void voice_alloc_set_max_voices(int8_t ch, uint8_t max_voices)
+{
+    channel_max_voices[ch] = (max_voices == 0 || max_voices > MAX_VOICE_NUM) ? MAX_VOICE_NUM : max_voices;
+}
+
+void voice_alloc_set_reserved_voices(int8_t ch, uint8_t reserved_voices)
+{
+    reserve_shortfall -= channel_shortfall(ch);
+    channel_reserved_voices[ch] = (reserved_voices > MAX_VOICE_NUM) ? MAX_VOICE_NUM : reserved_voices;
+    reserve_shortfall += channel_shortfall(ch);
+}
+
+// How loud a voice is right now: envelope level times its mixer gains
+static uint32_t voice_audibility(const voice_state_t *vs)
+{
+    uint32_t gain = ((uint32_t)(vs->gain.target_left >> 16) + (uint32_t)(vs->gain.target_right >> 16)) >> 1;
+    uint32_t level = (uint32_t)(vs->env.level >> 16);
+    if (vs->env.state == RELEASE)
+    {
+        level >>= 1; // Already fading out, a cut is less noticeable
+    }
+    return level * gain;
+}
+
+// Least audible of the oldest VOICE_STEAL_CANDIDATES voices on a list that ch may take.
+// A channel may take its own voices and those of channels holding more than their reservation.
+static int steal_candidate(const voice_list_t *list, const voice_link_t *links, int8_t ch)
+{
+    int voice = VOICE_NONE;
+    uint32_t quietest = UINT32_MAX;
+    int candidates = 0;
+    for (int8_t i = list->oldest; i != VOICE_NONE && candidates < VOICE_STEAL_CANDIDATES; i = links[i].next)
+    {
+        int owner = key_channel[i];
+        if (owner != ch && channel_voice_count[owner] <= channel_reserved_voices[owner])
+        {
+            continue;
+        }
+        candidates++;
+        uint32_t audibility = voice_audibility(&voice_state[i]);
+        if (audibility < quietest)
+        {
+            quietest = audibility;
+            voice = i;
+        }
+    }
+    return voice;
+}
+
+void voice_alloc_free(int voice)
+{
+    voice_mask_t bit = VOICE_MASK_BIT(voice);
+    if (voice_free_mask & bit)
+    {
+        return;
+    }
+    voice_free_mask |= bit;
+    voice_free_count++;
+
+    int ch = key_channel[voice];
+    list_remove(&age_list, age_link, voice);
+    list_remove(&channel_list[ch], channel_link, voice);
+    channel_count_add(ch, -1);
+
+    // Unlink from its key, usually the first entry
+    int8_t *link = &key_head[ch][key_note[voice]];
+    while (*link != VOICE_NONE && *link != voice)
+    {
+        link = &key_next[*link];
+    }
+    if (*link == voice)
+    {
+        *link = key_next[voice];
+    }
+}
+
+int voice_alloc_take(int8_t ch, uint8_t note, bool *stolen)
+{
+    int voice = VOICE_NONE;
+    *stolen = false;
+
+    if (channel_voice_count[ch] >= channel_max_voices[ch])
+    {
+        // At the channel limit: replace one of its own voices
+        voice = steal_candidate(&channel_list[ch], channel_link, ch);
+    }
+    else if (voice_free_mask != 0 &&
+             (channel_shortfall(ch) > 0 || voice_free_count > reserve_shortfall))
+    {
+        // A free voice that is not held back for another channel's reservation
+        voice = VOICE_MASK_FIRST(voice_free_mask);
+    }
+    else
+    {
+        voice = steal_candidate(&age_list, age_link, ch);
+    }
+
+    if (voice == VOICE_NONE)
+    {
+        voice_alloc_stats[ch].notes_dropped++;
+        return VOICE_NONE;
+    }
+    if ((voice_free_mask & VOICE_MASK_BIT(voice)) == 0)
+    {
+        voice_alloc_stats[key_channel[voice]].voices_stolen++;
+        voice_alloc_free(voice);
+        *stolen = true;
+    }
+
+    voice_free_mask &= ~VOICE_MASK_BIT(voice);
+    voice_free_count--;
+    list_append(&age_list, age_link, voice);
+    list_append(&channel_list[ch], channel_link, voice);
+    channel_count_add(ch, 1);
+
+    // First on its key
+    key_channel[voice] = ch;
+    key_note[voice] = note & 0x7F;
+    key_next[voice] = key_head[ch][note & 0x7F];
+    key_head[ch][note & 0x7F] = voice;
+
+    return voice;
+}
+
+int voice_alloc_find(int8_t ch, uint8_t note)
+{
+    return key_head[ch][note & 0x7F];
+}
+
+int voice_alloc_next(int voice)
+{
+    return key_next[voice];
+}
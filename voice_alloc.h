@@ -0,0 +1,43 @@
+#ifndef VOICE_ALLOC_H
+#define VOICE_ALLOC_H
+
+#include "synthesizer.h"
+
+// Voice allocation in constant time per note event:
+// - free voices are a bit mask, the lowest free voice is taken first
+// - sounding voices are kept in start order, stealing looks at the oldest few and takes the quietest
+// - every (channel, note) key has a list of the voices playing it, newest first
+// Each channel can be limited to a number of voices (it then replaces its own) and can reserve voices
+// that other channels neither take from the free pool nor steal.
+
+#define VOICE_NONE (-1)
+#define VOICE_STEAL_CANDIDATES 4 // Oldest voices compared when stealing
+
+typedef struct
+{
+    volatile uint32_t voices_stolen; // Voices of the channel cut off for another note
+    volatile uint32_t notes_dropped; // Note ons of the channel that found no voice
+} voice_alloc_stats_t;
+
+extern voice_alloc_stats_t voice_alloc_stats[MAX_CHANNEL_NUM];
+
+// Free all voices and clear the counters, also run on MIDI Reset
+void voice_alloc_init();
+
+// Channel limits, 0 max_voices means no limit. Reservations are kept as far as the pool allows.
+void voice_alloc_set_max_voices(int8_t ch, uint8_t max_voices);
+void voice_alloc_set_reserved_voices(int8_t ch, uint8_t reserved_voices);
+
+// Take a voice for a new note, stealing one if needed. Returns VOICE_NONE if the limits leave none.
+int voice_alloc_take(int8_t ch, uint8_t note, bool *stolen);
+
+// Return a voice that went idle, does nothing if it is already free
+void voice_alloc_free(int voice);
+
+// Newest voice playing a key, or VOICE_NONE
+int voice_alloc_find(int8_t ch, uint8_t note);
+
+// Next older voice playing the same key as voice, or VOICE_NONE
+int voice_alloc_next(int voice);
+
+#endif // VOICE_ALLOC_H
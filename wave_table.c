@@ -0,0 +1,5 @@
+#include "wave_table.h"
+
+fp_t sin_quarter_table[SIN_QUARTER_LENGTH + 1] = {0,402,804,1206,1608,2009,2410,2811,3212,3612,4011,4410,4808,5205,5602,5998,6393,6786,7179,7571,7962,8351,8739,9126,9512,9896,10278,10659,11039,11417,11793,12167,12539,12910,13279,13645,14010,14372,14732,15090,15446,15800,16151,16499,16846,17189,17530,17869,18204,18537,18868,19195,19519,19841,20159,20475,20787,21096,21403,21705,22005,22301,22594,22884,23170,23452,23731,24007,24279,24547,24811,25072,25329,25582,25832,26077,26319,26556,26790,27019,27245,27466,27683,27896,28105,28310,28510,28706,28898,29085,29268,29447,29621,29791,29956,30117,30273,30424,30571,30714,30852,30985,31113,31237,31356,31470,31580,31685,31785,31880,31971,32057,32137,32213,32285,32351,32412,32469,32521,32567,32609,32646,32678,32705,32728,32745,32757,32765,32767};
+const uint32_t pitch_semitone_table[12] = {1797877195,1904784536,2018048919,2138048352,2265183323,2399878133,2542582312,2693772124,2853952150,3023656976,3203452976,3393940203};
+const uint32_t pitch_fraction_table[(1 << PITCH_STEP_BITS) + 1] = {2147483648,2149422703,2151363509,2153306067,2155250379,2157196447,2159144272,2161093856,2163045200,2164998306,2166953175,2168909810,2170868212,2172828382,2174790321,2176754033,2178719517,2180686776,2182655811,2184626625,2186599218,2188573592,2190549748,2192527690,2194507417,2196488931,2198472235,2200457330,2202444217,2204432898,2206423375,2208415649,2210409722,2212405596,2214403271,2216402751,2218404036,2220407128,2222412028,2224418739,2226427262,2228437599,2230449750,2232463719,2234479506,2236497113,2238516542,2240537794,2242560872,2244585776,2246612509,2248641071,2250671465,2252703693,2254737756,2256773655,2258811392,2260850970,2262892389,2264935651,2266980759,2269027713,2271076515,2273127167,2275179671};
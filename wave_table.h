@@ -2,11 +2,12 @@
 #define WAVE_TABLE_H
 #include <stdint.h>
 #include "fp.h"
-#define TABLE_LENGTH 4096
-static const fp_t sin_table[] = {0,50,101,151,201,251,302,352,402,452,503,553,603,654,704,754,804,855,905,955,1005,1056,1106,1156,1206,1257,1307,1357,1407,1458,1508,1558,1608,1658,1709,1759,1809,1859,1909,1960,2010,2060,2110,2160,2210,2261,2311,2361,2411,2461,2511,2561,2612,2662,2712,2762,2812,2862,2912,2962,3012,3062,3112,3162,3213,3263,3313,3363,3413,3463,3513,3563,3613,3662,3712,3762,3812,3862,3912,3962,4012,4062,4112,4162,4212,4261,4311,4361,4411,4461,4510,4560,4610,4660,4710,4759,4809,4859,4909,4958,5008,5058,5107,5157,5207,5256,5306,5355,5405,5455,5504,5554,5603,5653,5702,5752,5801,5851,5900,5950,5999,6049,6098,6147,6197,6246,6295,6345,6394,6443,6493,6542,6591,6640,6690,6739,6788,6837,6886,6936,6985,7034,7083,7132,7181,7230,7279,7328,7377,7426,7475,7524,7573,7622,7671,7720,7768,7817,7866,7915,7964,8012,8061,8110,8159,8207,8256,8305,8353,8402,8450,8499,8547,8596,8645,8693,8741,8790,8838,8887,8935,8983,9032,9080,9128,9177,9225,9273,9321,9370,9418,9466,9514,9562,9610,9658,9706,9754,9802,9850,9898,9946,9994,10042,10090,10138,10185,10233,10281,10329,10376,10424,10472,10519,10567,10614,10662,10709,10757,10804,10852,10899,10947,10994,11041,11089,11136,11183,11231,11278,11325,11372,11419,11466,11513,11561,11608,11655,11702,11749,11795,11842,11889,11936,11983,12030,12076,12123,12170,12216,12263,12310,12356,12403,12449,12496,12542,12589,12635,12681,12728,12774,12820,12867,12913,12959,13005,13051,13098,13144,13190,13236,13282,13328,13373,13419,13465,13511,13557,13603,13648,13694,13740,13785,13831,13876,13922,13967,14013,14058,14104,14149,14194,14240,14285,14330,14375,14421,14466,14511,14556,14601,14646,14691,14736,14781,14825,14870,14915,14960,15005,15049,15094,15138,15183,15228,15272,15317,15361,15405,15450,15494,15538,15583,15627,15671,15715,15759,15803,15847,15891,15935,15979,16023,16067,16111,16154,16198,16242,16285,16329,16373,16416,16460,16503,16547,16590,16633,16677,16720,16763,16806,16849,16892,16935,16978,17021,17064,17107,17150,17193,17236,17279,17321,17364,17406,17449,17492,17534,17577,17619,17661,17704,17746,17788,17830,17873,17915,17957,17999,18041,18083,18125,18166,18208,18250,18292,18333,18375,18417,18458,18500,18541,18583,18624,18665,18707,18748,18789,18830,18872,18913,18954,18995,19036,19076,19117,19158,19199,19240,19280,19321,19362,19402,19443,19483,19523,19564,19604,19644,19685,19725,19765,19805,19845,19885,19925,19965,20005,20044,20084,20124,20163,20203,20243,20282,20322,20361,20400,20440,20479,20518,20557,20597,20636,20675,20714,20753,20791,20830,20869,20908,20946,20985,21024,21062,21101,21139,21178,21216,21254,21292,21331,21369,21407,21445,21483,21521,21559,21597,21634,21672,21710,21747,21785,21822,21860,21897,21935,21972,22009,22047,22084,22121,22158,22195,22232,22269,22306,22342,22379,22416,22453,22489,22526,22562,22599,22635,22671,22708,22744,22780,22816,22852,22888,22924,22960,22996,23032,23067,23103,23139,23174,23210,23245,23281,23316,23351,23386,23422,23457,23492,23527,23562,23597,23632,23666,23701,23736,23771,23805,23840,23874,23908,23943,23977,24011,24046,24080,24114,24148,24182,24216,24249,24283,24317,24351,24384,24418,24451,24485,24518,24551,24585,24618,24651,24684,24717,24750,24783,24816,24849,24881,24914,24947,24979,25012,25044,25077,25109,25141,25174,25206,25238,25270,25302,25334,25366,25397,25429,25461,25492,25524,25555,25587,25618,25650,25681,25712,25743,25774,25805,25836,25867,25898,25929,25959,25990,26021,26051,26082,26112,26142,26173,26203,26233,26263,26293,26323,26353,26383,26413,26442,26472,26502,26531,26561,26590,26619,26649,26678,26707,26736,26765,26794,26823,26852,26881,26909,26938,26967,26995,27024,27052,27080,27109,27137,27165,27193,27221,27249,27277,27305,27333,27360,27388,27416,27443,27470,27498,27525,27552,27580,27607,27634,27661,27688,27714,27741,27768,27795,27821,27848,27874,27901,27927,27953,27979,28006,28032,28058,28084,28109,28135,28161,28187,28212,28238,28263,28289,28314,28339,28364,28390,28415,28440,28465,28489,28514,28539,28564,28588,28613,28637,28662,28686,28710,28735,28759,28783,28807,28831,28854,28878,28902,28926,28949,28973,28996,29020,29043,29066,29089,29112,29135,29158,29181,29204,29227,29250,29272,29295,29317,29340,29362,29384,29407,29429,29451,29473,29495,29517,29538,29560,29582,29603,29625,29646,29668,29689,29710,29731,29753,29774,29795,29815,29836,29857,29878,29898,29919,29939,29960,29980,30000,30020,30041,30061,30081,30100,30120,30140,30160,30179,30199,30218,30238,30257,30276,30296,30315,30334,30353,30372,30390,30409,30428,30447,30465,30484,30502,30520,30539,30557,30575,30593,30611,30629,30647,30664,30682,30700,30717,30735,30752,30769,30787,30804,30821,30838,30855,30872,30889,30905,30922,30939,30955,30972,30988,31004,31020,31037,31053,31069,31085,31101,31116,31132,31148,31163,31179,31194,31210,31225,31240,31255,31270,31285,31300,31315,31330,31344,31359,31374,31388,31402,31417,31431,31445,31459,31473,31487,31501,31515,31529,31542,31556,31569,31583,31596,31609,31623,31636,31649,31662,31675,31688,31700,31713,31726,31738,31751,31763,31775,31788,31800,31812,31824,31836,31848,31859,31871,31883,31894,31906,31917,31929,31940,31951,31962,31973,31984,31995,32006,32017,32027,32038,32048,32059,32069,32079,32090,32100,32110,32120,32130,32140,32149,32159,32169,32178,32188,32197,32206,32215,32225,32234,32243,32252,32260,32269,32278,32287,32295,32304,32312,32320,32328,32337,32345,32353,32361,32368,32376,32384,32392,32399,32407,32414,32421,32429,32436,32443,32450,32457,32464,32470,32477,32484,32490,32497,32503,32510,32516,32522,32528,32534,32540,32546,32552,32557,32563,32569,32574,32580,32585,32590,32595,32600,32605,32610,32615,32620,32625,32629,32634,32638,32643,32647,32651,32656,32660,32664,32668,32672,32675,32679,32683,32686,32690,32693,32697,32700,32703,32706,32709,32712,32715,32718,32720,32723,32726,32728,32731,32733,32735,32737,32739,32741,32743,32745,32747,32749,32750,32752,32753,32755,32756,32757,32759,32760,32761,32762,32763,32763,32764,32765,32765,32766,32766,32766,32767,32767,32767,32767,32767,32767,32767,32766,32766,32765,32765,32764,32764,32763,32762,32761,32760,32759,32758,32757,32756,32754,32753,32751,32750,32748,32746,32744,32742,32740,32738,32736,32734,32732,32729,32727,32724,32722,32719,32716,32713,32711,32708,32705,32701,32698,32695,32692,32688,32685,32681,32677,32673,32670,32666,32662,32658,32654,32649,32645,32641,32636,32632,32627,32622,32618,32613,32608,32603,32598,32593,32587,32582,32577,32571,32566,32560,32555,32549,32543,32537,32531,32525,32519,32513,32506,32500,32494,32487,32480,32474,32467,32460,32453,32446,32439,32432,32425,32418,32410,32403,32395,32388,32380,32372,32365,32357,32349,32341,32333,32324,32316,32308,32299,32291,32282,32274,32265,32256,32247,32238,32229,32220,32211,32202,32192,32183,32173,32164,32154,32144,32135,32125,32115,32105,32095,32085,32074,32064,32054,32043,32033,32022,32011,32000,31990,31979,31968,31957,31945,31934,31923,31912,31900,31889,31877,31865,31854,31842,31830,31818,31806,31794,31781,31769,31757,31744,31732,31719,31707,31694,31681,31668,31655,31642,31629,31616,31603,31590,31576,31563,31549,31535,31522,31508,31494,31480,31466,31452,31438,31424,31410,31395,31381,31366,31352,31337,31322,31308,31293,31278,31263,31248,31232,31217,31202,31186,31171,31155,31140,31124,31108,31093,31077,31061,31045,31029,31012,30996,30980,30963,30947,30930,30914,30897,30880,30863,30846,30829,30812,30795,30778,30761,30743,30726,30708,30691,30673,30655,30638,30620,30602,30584,30566,30548,30529,30511,30493,30474,30456,30437,30419,30400,30381,30362,30343,30324,30305,30286,30267,30247,30228,30209,30189,30170,30150,30130,30110,30091,30071,30051,30030,30010,29990,29970,29949,29929,29909,29888,29867,29847,29826,29805,29784,29763,29742,29721,29700,29678,29657,29636,29614,29593,29571,29549,29527,29506,29484,29462,29440,29418,29395,29373,29351,29329,29306,29284,29261,29238,29216,29193,29170,29147,29124,29101,29078,29055,29031,29008,28984,28961,28937,28914,28890,28866,28843,28819,28795,28771,28747,28722,28698,28674,28650,28625,28601,28576,28551,28527,28502,28477,28452,28427,28402,28377,28352,28327,28301,28276,28251,28225,28199,28174,28148,28122,28097,28071,28045,28019,27993,27966,27940,27914,27887,27861,27835,27808,27781,27755,27728,27701,27674,27647,27620,27593,27566,27539,27511,27484,27457,27429,27402,27374,27346,27319,27291,27263,27235,27207,27179,27151,27123,27095,27066,27038,27009,26981,26952,26924,26895,26866,26838,26809,26780,26751,26722,26693,26663,26634,26605,26575,26546,26516,26487,26457,26428,26398,26368,26338,26308,26278,26248,26218,26188,26158,26127,26097,26066,26036,26005,25975,25944,25913,25883,25852,25821,25790,25759,25728,25696,25665,25634,25603,25571,25540,25508,25477,25445,25413,25381,25350,25318,25286,25254,25222,25190,25157,25125,25093,25061,25028,24996,24963,24931,24898,24865,24832,24800,24767,24734,24701,24668,24634,24601,24568,24535,24501,24468,24435,24401,24367,24334,24300,24266,24233,24199,24165,24131,24097,24063,24028,23994,23960,23926,23891,23857,23822,23788,23753,23719,23684,23649,23614,23579,23544,23509,23474,23439,23404,23369,23334,23298,23263,23227,23192,23156,23121,23085,23049,23014,22978,22942,22906,22870,22834,22798,22762,22726,22689,22653,22617,22580,22544,22507,22471,22434,22398,22361,22324,22287,22250,22213,22176,22139,22102,22065,22028,21991,21953,21916,21879,21841,21804,21766,21729,21691,21653,21615,21578,21540,21502,21464,21426,21388,21350,21312,21273,21235,21197,21158,21120,21081,21043,21004,20966,20927,20888,20850,20811,20772,20733,20694,20655,20616,20577,20538,20499,20459,20420,20381,20341,20302,20262,20223,20183,20144,20104,20064,20024,19985,19945,19905,19865,19825,19785,19745,19705,19664,19624,19584,19544,19503,19463,19422,19382,19341,19301,19260,19219,19179,19138,19097,19056,19015,18974,18933,18892,18851,18810,18769,18727,18686,18645,18603,18562,18521,18479,18438,18396,18354,18313,18271,18229,18187,18146,18104,18062,18020,17978,17936,17894,17851,17809,17767,17725,17682,17640,17598,17555,17513,17470,17428,17385,17343,17300,17257,17214,17172,17129,17086,17043,17000,16957,16914,16871,16828,16785,16741,16698,16655,16612,16568,16525,16481,16438,16394,16351,16307,16264,16220,16176,16133,16089,16045,16001,15957,15913,15869,15825,15781,15737,15693,15649,15605,15560,15516,15472,15428,15383,15339,15294,15250,15205,15161,15116,15072,15027,14982,14937,14893,14848,14803,14758,14713,14668,14623,14578,14533,14488,14443,14398,14353,14308,14262,14217,14172,14126,14081,14036,13990,13945,13899,13854,13808,13762,13717,13671,13625,13580,13534,13488,13442,13396,13351,13305,13259,13213,13167,13121,13074,13028,12982,12936,12890,12844,12797,12751,12705,12658,12612,12566,12519,12473,12426,12380,12333,12286,12240,12193,12146,12100,12053,12006,11959,11913,11866,11819,11772,11725,11678,11631,11584,11537,11490,11443,11396,11349,11301,11254,11207,11160,11112,11065,11018,10970,10923,10876,10828,10781,10733,10686,10638,10591,10543,10495,10448,10400,10352,10305,10257,10209,10161,10114,10066,10018,9970,9922,9874,9826,9778,9730,9682,9634,9586,9538,9490,9442,9394,9345,9297,9249,9201,9153,9104,9056,9008,8959,8911,8863,8814,8766,8717,8669,8620,8572,8523,8475,8426,8377,8329,8280,8232,8183,8134,8085,8037,7988,7939,7890,7842,7793,7744,7695,7646,7597,7548,7500,7451,7402,7353,7304,7255,7206,7156,7107,7058,7009,6960,6911,6862,6813,6763,6714,6665,6616,6567,6517,6468,6419,6369,6320,6271,6221,6172,6123,6073,6024,5974,5925,5876,5826,5777,5727,5678,5628,5578,5529,5479,5430,5380,5331,5281,5231,5182,5132,5082,5033,4983,4933,4884,4834,4784,4734,4685,4635,4585,4535,4486,4436,4386,4336,4286,4236,4187,4137,4087,4037,3987,3937,3887,3837,3787,3737,3687,3638,3588,3538,3488,3438,3388,3338,3288,3238,3187,3137,3087,3037,2987,2937,2887,2837,2787,2737,2687,2637,2587,2536,2486,2436,2386,2336,2286,2236,2185,2135,2085,2035,1985,1935,1884,1834,1784,1734,1684,1633,1583,1533,1483,1432,1382,1332,1282,1231,1181,1131,1081,1030,980,930,880,829,779,729,679,628,578,528,478,427,377,327,277,226,176,126,75,25,-25,-75,-126,-176,-226,-277,-327,-377,-427,-478,-528,-578,-628,-679,-729,-779,-829,-880,-930,-980,-1030,-1081,-1131,-1181,-1231,-1282,-1332,-1382,-1432,-1483,-1533,-1583,-1633,-1684,-1734,-1784,-1834,-1884,-1935,-1985,-2035,-2085,-2135,-2185,-2236,-2286,-2336,-2386,-2436,-2486,-2536,-2587,-2637,-2687,-2737,-2787,-2837,-2887,-2937,-2987,-3037,-3087,-3137,-3187,-3238,-3288,-3338,-3388,-3438,-3488,-3538,-3588,-3638,-3687,-3737,-3787,-3837,-3887,-3937,-3987,-4037,-4087,-4137,-4187,-4236,-4286,-4336,-4386,-4436,-4486,-4535,-4585,-4635,-4685,-4734,-4784,-4834,-4884,-4933,-4983,-5033,-5082,-5132,-5182,-5231,-5281,-5331,-5380,-5430,-5479,-5529,-5578,-5628,-5678,-5727,-5777,-5826,-5876,-5925,-5974,-6024,-6073,-6123,-6172,-6221,-6271,-6320,-6369,-6419,-6468,-6517,-6567,-6616,-6665,-6714,-6763,-6813,-6862,-6911,-6960,-7009,-7058,-7107,-7156,-7206,-7255,-7304,-7353,-7402,-7451,-7500,-7548,-7597,-7646,-7695,-7744,-7793,-7842,-7890,-7939,-7988,-8037,-8085,-8134,-8183,-8232,-8280,-8329,-8377,-8426,-8475,-8523,-8572,-8620,-8669,-8717,-8766,-8814,-8863,-8911,-8959,-9008,-9056,-9104,-9153,-9201,-9249,-9297,-9345,-9394,-9442,-9490,-9538,-9586,-9634,-9682,-9730,-9778,-9826,-9874,-9922,-9970,-10018,-10066,-10114,-10161,-10209,-10257,-10305,-10352,-10400,-10448,-10495,-10543,-10591,-10638,-10686,-10733,-10781,-10828,-10876,-10923,-10970,-11018,-11065,-11112,-11160,-11207,-11254,-11301,-11349,-11396,-11443,-11490,-11537,-11584,-11631,-11678,-11725,-11772,-11819,-11866,-11913,-11959,-12006,-12053,-12100,-12146,-12193,-12240,-12286,-12333,-12380,-12426,-12473,-12519,-12566,-12612,-12658,-12705,-12751,-12797,-12844,-12890,-12936,-12982,-13028,-13074,-13121,-13167,-13213,-13259,-13305,-13351,-13396,-13442,-13488,-13534,-13580,-13625,-13671,-13717,-13762,-13808,-13854,-13899,-13945,-13990,-14036,-14081,-14126,-14172,-14217,-14262,-14308,-14353,-14398,-14443,-14488,-14533,-14578,-14623,-14668,-14713,-14758,-14803,-14848,-14893,-14937,-14982,-15027,-15072,-15116,-15161,-15205,-15250,-15294,-15339,-15383,-15428,-15472,-15516,-15560,-15605,-15649,-15693,-15737,-15781,-15825,-15869,-15913,-15957,-16001,-16045,-16089,-16133,-16176,-16220,-16264,-16307,-16351,-16394,-16438,-16481,-16525,-16568,-16612,-16655,-16698,-16741,-16785,-16828,-16871,-16914,-16957,-17000,-17043,-17086,-17129,-17172,-17214,-17257,-17300,-17343,-17385,-17428,-17470,-17513,-17555,-17598,-17640,-17682,-17725,-17767,-17809,-17851,-17894,-17936,-17978,-18020,-18062,-18104,-18146,-18187,-18229,-18271,-18313,-18354,-18396,-18438,-18479,-18521,-18562,-18603,-18645,-18686,-18727,-18769,-18810,-18851,-18892,-18933,-18974,-19015,-19056,-19097,-19138,-19179,-19219,-19260,-19301,-19341,-19382,-19422,-19463,-19503,-19544,-19584,-19624,-19664,-19705,-19745,-19785,-19825,-19865,-19905,-19945,-19985,-20024,-20064,-20104,-20144,-20183,-20223,-20262,-20302,-20341,-20381,-20420,-20459,-20499,-20538,-20577,-20616,-20655,-20694,-20733,-20772,-20811,-20850,-20888,-20927,-20966,-21004,-21043,-21081,-21120,-21158,-21197,-21235,-21273,-21312,-21350,-21388,-21426,-21464,-21502,-21540,-21578,-21615,-21653,-21691,-21729,-21766,-21804,-21841,-21879,-21916,-21953,-21991,-22028,-22065,-22102,-22139,-22176,-22213,-22250,-22287,-22324,-22361,-22398,-22434,-22471,-22507,-22544,-22580,-22617,-22653,-22689,-22726,-22762,-22798,-22834,-22870,-22906,-22942,-22978,-23014,-23049,-23085,-23121,-23156,-23192,-23227,-23263,-23298,-23334,-23369,-23404,-23439,-23474,-23509,-23544,-23579,-23614,-23649,-23684,-23719,-23753,-23788,-23822,-23857,-23891,-23926,-23960,-23994,-24028,-24063,-24097,-24131,-24165,-24199,-24233,-24266,-24300,-24334,-24367,-24401,-24435,-24468,-24501,-24535,-24568,-24601,-24634,-24668,-24701,-24734,-24767,-24800,-24832,-24865,-24898,-24931,-24963,-24996,-25028,-25061,-25093,-25125,-25157,-25190,-25222,-25254,-25286,-25318,-25350,-25381,-25413,-25445,-25477,-25508,-25540,-25571,-25603,-25634,-25665,-25696,-25728,-25759,-25790,-25821,-25852,-25883,-25913,-25944,-25975,-26005,-26036,-26066,-26097,-26127,-26158,-26188,-26218,-26248,-26278,-26308,-26338,-26368,-26398,-26428,-26457,-26487,-26516,-26546,-26575,-26605,-26634,-26663,-26693,-26722,-26751,-26780,-26809,-26838,-26866,-26895,-26924,-26952,-26981,-27009,-27038,-27066,-27095,-27123,-27151,-27179,-27207,-27235,-27263,-27291,-27319,-27346,-27374,-27402,-27429,-27457,-27484,-27511,-27539,-27566,-27593,-27620,-27647,-27674,-27701,-27728,-27755,-27781,-27808,-27835,-27861,-27887,-27914,-27940,-27966,-27993,-28019,-28045,-28071,-28097,-28122,-28148,-28174,-28199,-28225,-28251,-28276,-28301,-28327,-28352,-28377,-28402,-28427,-28452,-28477,-28502,-28527,-28551,-28576,-28601,-28625,-28650,-28674,-28698,-28722,-28747,-28771,-28795,-28819,-28843,-28866,-28890,-28914,-28937,-28961,-28984,-29008,-29031,-29055,-29078,-29101,-29124,-29147,-29170,-29193,-29216,-29238,-29261,-29284,-29306,-29329,-29351,-29373,-29395,-29418,-29440,-29462,-29484,-29506,-29527,-29549,-29571,-29593,-29614,-29636,-29657,-29678,-29700,-29721,-29742,-29763,-29784,-29805,-29826,-29847,-29867,-29888,-29909,-29929,-29949,-29970,-29990,-30010,-30030,-30051,-30071,-30091,-30110,-30130,-30150,-30170,-30189,-30209,-30228,-30247,-30267,-30286,-30305,-30324,-30343,-30362,-30381,-30400,-30419,-30437,-30456,-30474,-30493,-30511,-30529,-30548,-30566,-30584,-30602,-30620,-30638,-30655,-30673,-30691,-30708,-30726,-30743,-30761,-30778,-30795,-30812,-30829,-30846,-30863,-30880,-30897,-30914,-30930,-30947,-30963,-30980,-30996,-31012,-31029,-31045,-31061,-31077,-31093,-31108,-31124,-31140,-31155,-31171,-31186,-31202,-31217,-31232,-31248,-31263,-31278,-31293,-31308,-31322,-31337,-31352,-31366,-31381,-31395,-31410,-31424,-31438,-31452,-31466,-31480,-31494,-31508,-31522,-31535,-31549,-31563,-31576,-31590,-31603,-31616,-31629,-31642,-31655,-31668,-31681,-31694,-31707,-31719,-31732,-31744,-31757,-31769,-31781,-31794,-31806,-31818,-31830,-31842,-31854,-31865,-31877,-31889,-31900,-31912,-31923,-31934,-31945,-31957,-31968,-31979,-31990,-32000,-32011,-32022,-32033,-32043,-32054,-32064,-32074,-32085,-32095,-32105,-32115,-32125,-32135,-32144,-32154,-32164,-32173,-32183,-32192,-32202,-32211,-32220,-32229,-32238,-32247,-32256,-32265,-32274,-32282,-32291,-32299,-32308,-32316,-32324,-32333,-32341,-32349,-32357,-32365,-32372,-32380,-32388,-32395,-32403,-32410,-32418,-32425,-32432,-32439,-32446,-32453,-32460,-32467,-32474,-32480,-32487,-32494,-32500,-32506,-32513,-32519,-32525,-32531,-32537,-32543,-32549,-32555,-32560,-32566,-32571,-32577,-32582,-32587,-32593,-32598,-32603,-32608,-32613,-32618,-32622,-32627,-32632,-32636,-32641,-32645,-32649,-32654,-32658,-32662,-32666,-32670,-32673,-32677,-32681,-32685,-32688,-32692,-32695,-32698,-32701,-32705,-32708,-32711,-32713,-32716,-32719,-32722,-32724,-32727,-32729,-32732,-32734,-32736,-32738,-32740,-32742,-32744,-32746,-32748,-32750,-32751,-32753,-32754,-32756,-32757,-32758,-32759,-32760,-32761,-32762,-32763,-32764,-32764,-32765,-32765,-32766,-32766,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32766,-32766,-32766,-32765,-32765,-32764,-32763,-32763,-32762,-32761,-32760,-32759,-32757,-32756,-32755,-32753,-32752,-32750,-32749,-32747,-32745,-32743,-32741,-32739,-32737,-32735,-32733,-32731,-32728,-32726,-32723,-32720,-32718,-32715,-32712,-32709,-32706,-32703,-32700,-32697,-32693,-32690,-32686,-32683,-32679,-32675,-32672,-32668,-32664,-32660,-32656,-32651,-32647,-32643,-32638,-32634,-32629,-32625,-32620,-32615,-32610,-32605,-32600,-32595,-32590,-32585,-32580,-32574,-32569,-32563,-32557,-32552,-32546,-32540,-32534,-32528,-32522,-32516,-32510,-32503,-32497,-32490,-32484,-32477,-32470,-32464,-32457,-32450,-32443,-32436,-32429,-32421,-32414,-32407,-32399,-32392,-32384,-32376,-32368,-32361,-32353,-32345,-32337,-32328,-32320,-32312,-32304,-32295,-32287,-32278,-32269,-32260,-32252,-32243,-32234,-32225,-32215,-32206,-32197,-32188,-32178,-32169,-32159,-32149,-32140,-32130,-32120,-32110,-32100,-32090,-32079,-32069,-32059,-32048,-32038,-32027,-32017,-32006,-31995,-31984,-31973,-31962,-31951,-31940,-31929,-31917,-31906,-31894,-31883,-31871,-31859,-31848,-31836,-31824,-31812,-31800,-31788,-31775,-31763,-31751,-31738,-31726,-31713,-31700,-31688,-31675,-31662,-31649,-31636,-31623,-31609,-31596,-31583,-31569,-31556,-31542,-31529,-31515,-31501,-31487,-31473,-31459,-31445,-31431,-31417,-31402,-31388,-31374,-31359,-31344,-31330,-31315,-31300,-31285,-31270,-31255,-31240,-31225,-31210,-31194,-31179,-31163,-31148,-31132,-31116,-31101,-31085,-31069,-31053,-31037,-31020,-31004,-30988,-30972,-30955,-30939,-30922,-30905,-30889,-30872,-30855,-30838,-30821,-30804,-30787,-30769,-30752,-30735,-30717,-30700,-30682,-30664,-30647,-30629,-30611,-30593,-30575,-30557,-30539,-30520,-30502,-30484,-30465,-30447,-30428,-30409,-30390,-30372,-30353,-30334,-30315,-30296,-30276,-30257,-30238,-30218,-30199,-30179,-30160,-30140,-30120,-30100,-30081,-30061,-30041,-30020,-30000,-29980,-29960,-29939,-29919,-29898,-29878,-29857,-29836,-29815,-29795,-29774,-29753,-29731,-29710,-29689,-29668,-29646,-29625,-29603,-29582,-29560,-29538,-29517,-29495,-29473,-29451,-29429,-29407,-29384,-29362,-29340,-29317,-29295,-29272,-29250,-29227,-29204,-29181,-29158,-29135,-29112,-29089,-29066,-29043,-29020,-28996,-28973,-28949,-28926,-28902,-28878,-28854,-28831,-28807,-28783,-28759,-28735,-28710,-28686,-28662,-28637,-28613,-28588,-28564,-28539,-28514,-28489,-28465,-28440,-28415,-28390,-28364,-28339,-28314,-28289,-28263,-28238,-28212,-28187,-28161,-28135,-28109,-28084,-28058,-28032,-28006,-27979,-27953,-27927,-27901,-27874,-27848,-27821,-27795,-27768,-27741,-27714,-27688,-27661,-27634,-27607,-27580,-27552,-27525,-27498,-27470,-27443,-27416,-27388,-27360,-27333,-27305,-27277,-27249,-27221,-27193,-27165,-27137,-27109,-27080,-27052,-27024,-26995,-26967,-26938,-26909,-26881,-26852,-26823,-26794,-26765,-26736,-26707,-26678,-26649,-26619,-26590,-26561,-26531,-26502,-26472,-26442,-26413,-26383,-26353,-26323,-26293,-26263,-26233,-26203,-26173,-26142,-26112,-26082,-26051,-26021,-25990,-25959,-25929,-25898,-25867,-25836,-25805,-25774,-25743,-25712,-25681,-25650,-25618,-25587,-25555,-25524,-25492,-25461,-25429,-25397,-25366,-25334,-25302,-25270,-25238,-25206,-25174,-25141,-25109,-25077,-25044,-25012,-24979,-24947,-24914,-24881,-24849,-24816,-24783,-24750,-24717,-24684,-24651,-24618,-24585,-24551,-24518,-24485,-24451,-24418,-24384,-24351,-24317,-24283,-24249,-24216,-24182,-24148,-24114,-24080,-24046,-24011,-23977,-23943,-23908,-23874,-23840,-23805,-23771,-23736,-23701,-23666,-23632,-23597,-23562,-23527,-23492,-23457,-23422,-23386,-23351,-23316,-23281,-23245,-23210,-23174,-23139,-23103,-23067,-23032,-22996,-22960,-22924,-22888,-22852,-22816,-22780,-22744,-22708,-22671,-22635,-22599,-22562,-22526,-22489,-22453,-22416,-22379,-22342,-22306,-22269,-22232,-22195,-22158,-22121,-22084,-22047,-22009,-21972,-21935,-21897,-21860,-21822,-21785,-21747,-21710,-21672,-21634,-21597,-21559,-21521,-21483,-21445,-21407,-21369,-21331,-21292,-21254,-21216,-21178,-21139,-21101,-21062,-21024,-20985,-20946,-20908,-20869,-20830,-20791,-20753,-20714,-20675,-20636,-20597,-20557,-20518,-20479,-20440,-20400,-20361,-20322,-20282,-20243,-20203,-20163,-20124,-20084,-20044,-20005,-19965,-19925,-19885,-19845,-19805,-19765,-19725,-19685,-19644,-19604,-19564,-19523,-19483,-19443,-19402,-19362,-19321,-19280,-19240,-19199,-19158,-19117,-19076,-19036,-18995,-18954,-18913,-18872,-18830,-18789,-18748,-18707,-18665,-18624,-18583,-18541,-18500,-18458,-18417,-18375,-18333,-18292,-18250,-18208,-18166,-18125,-18083,-18041,-17999,-17957,-17915,-17873,-17830,-17788,-17746,-17704,-17661,-17619,-17577,-17534,-17492,-17449,-17406,-17364,-17321,-17279,-17236,-17193,-17150,-17107,-17064,-17021,-16978,-16935,-16892,-16849,-16806,-16763,-16720,-16677,-16633,-16590,-16547,-16503,-16460,-16416,-16373,-16329,-16285,-16242,-16198,-16154,-16111,-16067,-16023,-15979,-15935,-15891,-15847,-15803,-15759,-15715,-15671,-15627,-15583,-15538,-15494,-15450,-15405,-15361,-15317,-15272,-15228,-15183,-15138,-15094,-15049,-15005,-14960,-14915,-14870,-14825,-14781,-14736,-14691,-14646,-14601,-14556,-14511,-14466,-14421,-14375,-14330,-14285,-14240,-14194,-14149,-14104,-14058,-14013,-13967,-13922,-13876,-13831,-13785,-13740,-13694,-13648,-13603,-13557,-13511,-13465,-13419,-13373,-13328,-13282,-13236,-13190,-13144,-13098,-13051,-13005,-12959,-12913,-12867,-12820,-12774,-12728,-12681,-12635,-12589,-12542,-12496,-12449,-12403,-12356,-12310,-12263,-12216,-12170,-12123,-12076,-12030,-11983,-11936,-11889,-11842,-11795,-11749,-11702,-11655,-11608,-11561,-11513,-11466,-11419,-11372,-11325,-11278,-11231,-11183,-11136,-11089,-11041,-10994,-10947,-10899,-10852,-10804,-10757,-10709,-10662,-10614,-10567,-10519,-10472,-10424,-10376,-10329,-10281,-10233,-10185,-10138,-10090,-10042,-9994,-9946,-9898,-9850,-9802,-9754,-9706,-9658,-9610,-9562,-9514,-9466,-9418,-9370,-9321,-9273,-9225,-9177,-9128,-9080,-9032,-8983,-8935,-8887,-8838,-8790,-8741,-8693,-8645,-8596,-8547,-8499,-8450,-8402,-8353,-8305,-8256,-8207,-8159,-8110,-8061,-8012,-7964,-7915,-7866,-7817,-7768,-7720,-7671,-7622,-7573,-7524,-7475,-7426,-7377,-7328,-7279,-7230,-7181,-7132,-7083,-7034,-6985,-6936,-6886,-6837,-6788,-6739,-6690,-6640,-6591,-6542,-6493,-6443,-6394,-6345,-6295,-6246,-6197,-6147,-6098,-6049,-5999,-5950,-5900,-5851,-5801,-5752,-5702,-5653,-5603,-5554,-5504,-5455,-5405,-5355,-5306,-5256,-5207,-5157,-5107,-5058,-5008,-4958,-4909,-4859,-4809,-4759,-4710,-4660,-4610,-4560,-4510,-4461,-4411,-4361,-4311,-4261,-4212,-4162,-4112,-4062,-4012,-3962,-3912,-3862,-3812,-3762,-3712,-3662,-3613,-3563,-3513,-3463,-3413,-3363,-3313,-3263,-3213,-3162,-3112,-3062,-3012,-2962,-2912,-2862,-2812,-2762,-2712,-2662,-2612,-2561,-2511,-2461,-2411,-2361,-2311,-2261,-2210,-2160,-2110,-2060,-2010,-1960,-1909,-1859,-1809,-1759,-1709,-1658,-1608,-1558,-1508,-1458,-1407,-1357,-1307,-1257,-1206,-1156,-1106,-1056,-1005,-955,-905,-855,-804,-754,-704,-654,-603,-553,-503,-452,-402,-352,-302,-251,-201,-151,-101,-50,0};
-static const fp_t sawtooth_table[] = {-32767,-32751,-32735,-32719,-32703,-32687,-32671,-32655,-32639,-32623,-32607,-32591,-32575,-32559,-32543,-32527,-32511,-32495,-32479,-32463,-32447,-32431,-32415,-32399,-32383,-32367,-32351,-32335,-32319,-32303,-32287,-32271,-32255,-32239,-32223,-32207,-32191,-32175,-32159,-32143,-32127,-32111,-32095,-32079,-32063,-32047,-32031,-32015,-31999,-31983,-31967,-31951,-31935,-31919,-31903,-31887,-31871,-31855,-31839,-31823,-31807,-31791,-31775,-31759,-31743,-31727,-31711,-31695,-31679,-31663,-31647,-31631,-31615,-31599,-31583,-31567,-31551,-31535,-31519,-31503,-31487,-31471,-31455,-31439,-31423,-31407,-31391,-31375,-31359,-31343,-31327,-31311,-31295,-31279,-31263,-31247,-31231,-31215,-31199,-31183,-31167,-31151,-31135,-31119,-31103,-31087,-31071,-31055,-31039,-31023,-31007,-30991,-30975,-30959,-30943,-30927,-30911,-30895,-30879,-30863,-30847,-30831,-30815,-30799,-30783,-30767,-30751,-30735,-30719,-30703,-30687,-30671,-30655,-30639,-30623,-30607,-30591,-30575,-30559,-30543,-30527,-30511,-30495,-30479,-30463,-30447,-30431,-30414,-30398,-30382,-30366,-30350,-30334,-30318,-30302,-30286,-30270,-30254,-30238,-30222,-30206,-30190,-30174,-30158,-30142,-30126,-30110,-30094,-30078,-30062,-30046,-30030,-30014,-29998,-29982,-29966,-29950,-29934,-29918,-29902,-29886,-29870,-29854,-29838,-29822,-29806,-29790,-29774,-29758,-29742,-29726,-29710,-29694,-29678,-29662,-29646,-29630,-29614,-29598,-29582,-29566,-29550,-29534,-29518,-29502,-29486,-29470,-29454,-29438,-29422,-29406,-29390,-29374,-29358,-29342,-29326,-29310,-29294,-29278,-29262,-29246,-29230,-29214,-29198,-29182,-29166,-29150,-29134,-29118,-29102,-29086,-29070,-29054,-29038,-29022,-29006,-28990,-28974,-28958,-28942,-28926,-28910,-28894,-28878,-28862,-28846,-28830,-28814,-28798,-28782,-28766,-28750,-28734,-28718,-28702,-28686,-28670,-28654,-28638,-28622,-28606,-28590,-28574,-28558,-28542,-28526,-28510,-28494,-28478,-28462,-28446,-28430,-28414,-28398,-28382,-28366,-28350,-28334,-28318,-28302,-28286,-28270,-28254,-28238,-28222,-28206,-28190,-28174,-28158,-28142,-28126,-28110,-28094,-28078,-28062,-28046,-28030,-28014,-27998,-27982,-27966,-27950,-27934,-27918,-27902,-27886,-27870,-27854,-27838,-27822,-27806,-27790,-27774,-27758,-27742,-27726,-27710,-27694,-27678,-27662,-27646,-27630,-27614,-27598,-27582,-27566,-27550,-27534,-27518,-27502,-27486,-27470,-27454,-27438,-27422,-27406,-27390,-27374,-27358,-27342,-27326,-27310,-27294,-27278,-27262,-27246,-27230,-27214,-27198,-27182,-27166,-27150,-27134,-27118,-27102,-27086,-27070,-27054,-27038,-27022,-27006,-26990,-26974,-26958,-26942,-26926,-26910,-26894,-26878,-26862,-26846,-26830,-26814,-26798,-26782,-26766,-26750,-26734,-26718,-26702,-26686,-26670,-26654,-26638,-26622,-26606,-26590,-26574,-26558,-26542,-26526,-26510,-26494,-26478,-26462,-26446,-26430,-26414,-26398,-26382,-26366,-26350,-26334,-26318,-26302,-26286,-26270,-26254,-26238,-26222,-26206,-26190,-26174,-26158,-26142,-26126,-26110,-26094,-26078,-26062,-26046,-26030,-26014,-25998,-25982,-25966,-25950,-25934,-25918,-25902,-25886,-25870,-25854,-25838,-25822,-25806,-25790,-25774,-25758,-25741,-25725,-25709,-25693,-25677,-25661,-25645,-25629,-25613,-25597,-25581,-25565,-25549,-25533,-25517,-25501,-25485,-25469,-25453,-25437,-25421,-25405,-25389,-25373,-25357,-25341,-25325,-25309,-25293,-25277,-25261,-25245,-25229,-25213,-25197,-25181,-25165,-25149,-25133,-25117,-25101,-25085,-25069,-25053,-25037,-25021,-25005,-24989,-24973,-24957,-24941,-24925,-24909,-24893,-24877,-24861,-24845,-24829,-24813,-24797,-24781,-24765,-24749,-24733,-24717,-24701,-24685,-24669,-24653,-24637,-24621,-24605,-24589,-24573,-24557,-24541,-24525,-24509,-24493,-24477,-24461,-24445,-24429,-24413,-24397,-24381,-24365,-24349,-24333,-24317,-24301,-24285,-24269,-24253,-24237,-24221,-24205,-24189,-24173,-24157,-24141,-24125,-24109,-24093,-24077,-24061,-24045,-24029,-24013,-23997,-23981,-23965,-23949,-23933,-23917,-23901,-23885,-23869,-23853,-23837,-23821,-23805,-23789,-23773,-23757,-23741,-23725,-23709,-23693,-23677,-23661,-23645,-23629,-23613,-23597,-23581,-23565,-23549,-23533,-23517,-23501,-23485,-23469,-23453,-23437,-23421,-23405,-23389,-23373,-23357,-23341,-23325,-23309,-23293,-23277,-23261,-23245,-23229,-23213,-23197,-23181,-23165,-23149,-23133,-23117,-23101,-23085,-23069,-23053,-23037,-23021,-23005,-22989,-22973,-22957,-22941,-22925,-22909,-22893,-22877,-22861,-22845,-22829,-22813,-22797,-22781,-22765,-22749,-22733,-22717,-22701,-22685,-22669,-22653,-22637,-22621,-22605,-22589,-22573,-22557,-22541,-22525,-22509,-22493,-22477,-22461,-22445,-22429,-22413,-22397,-22381,-22365,-22349,-22333,-22317,-22301,-22285,-22269,-22253,-22237,-22221,-22205,-22189,-22173,-22157,-22141,-22125,-22109,-22093,-22077,-22061,-22045,-22029,-22013,-21997,-21981,-21965,-21949,-21933,-21917,-21901,-21885,-21869,-21853,-21837,-21821,-21805,-21789,-21773,-21757,-21741,-21725,-21709,-21693,-21677,-21661,-21645,-21629,-21613,-21597,-21581,-21565,-21549,-21533,-21517,-21501,-21485,-21469,-21453,-21437,-21421,-21405,-21389,-21373,-21357,-21341,-21325,-21309,-21293,-21277,-21261,-21245,-21229,-21213,-21197,-21181,-21165,-21149,-21133,-21117,-21101,-21085,-21069,-21052,-21036,-21020,-21004,-20988,-20972,-20956,-20940,-20924,-20908,-20892,-20876,-20860,-20844,-20828,-20812,-20796,-20780,-20764,-20748,-20732,-20716,-20700,-20684,-20668,-20652,-20636,-20620,-20604,-20588,-20572,-20556,-20540,-20524,-20508,-20492,-20476,-20460,-20444,-20428,-20412,-20396,-20380,-20364,-20348,-20332,-20316,-20300,-20284,-20268,-20252,-20236,-20220,-20204,-20188,-20172,-20156,-20140,-20124,-20108,-20092,-20076,-20060,-20044,-20028,-20012,-19996,-19980,-19964,-19948,-19932,-19916,-19900,-19884,-19868,-19852,-19836,-19820,-19804,-19788,-19772,-19756,-19740,-19724,-19708,-19692,-19676,-19660,-19644,-19628,-19612,-19596,-19580,-19564,-19548,-19532,-19516,-19500,-19484,-19468,-19452,-19436,-19420,-19404,-19388,-19372,-19356,-19340,-19324,-19308,-19292,-19276,-19260,-19244,-19228,-19212,-19196,-19180,-19164,-19148,-19132,-19116,-19100,-19084,-19068,-19052,-19036,-19020,-19004,-18988,-18972,-18956,-18940,-18924,-18908,-18892,-18876,-18860,-18844,-18828,-18812,-18796,-18780,-18764,-18748,-18732,-18716,-18700,-18684,-18668,-18652,-18636,-18620,-18604,-18588,-18572,-18556,-18540,-18524,-18508,-18492,-18476,-18460,-18444,-18428,-18412,-18396,-18380,-18364,-18348,-18332,-18316,-18300,-18284,-18268,-18252,-18236,-18220,-18204,-18188,-18172,-18156,-18140,-18124,-18108,-18092,-18076,-18060,-18044,-18028,-18012,-17996,-17980,-17964,-17948,-17932,-17916,-17900,-17884,-17868,-17852,-17836,-17820,-17804,-17788,-17772,-17756,-17740,-17724,-17708,-17692,-17676,-17660,-17644,-17628,-17612,-17596,-17580,-17564,-17548,-17532,-17516,-17500,-17484,-17468,-17452,-17436,-17420,-17404,-17388,-17372,-17356,-17340,-17324,-17308,-17292,-17276,-17260,-17244,-17228,-17212,-17196,-17180,-17164,-17148,-17132,-17116,-17100,-17084,-17068,-17052,-17036,-17020,-17004,-16988,-16972,-16956,-16940,-16924,-16908,-16892,-16876,-16860,-16844,-16828,-16812,-16796,-16780,-16764,-16748,-16732,-16716,-16700,-16684,-16668,-16652,-16636,-16620,-16604,-16588,-16572,-16556,-16540,-16524,-16508,-16492,-16476,-16460,-16444,-16428,-16412,-16396,-16379,-16363,-16347,-16331,-16315,-16299,-16283,-16267,-16251,-16235,-16219,-16203,-16187,-16171,-16155,-16139,-16123,-16107,-16091,-16075,-16059,-16043,-16027,-16011,-15995,-15979,-15963,-15947,-15931,-15915,-15899,-15883,-15867,-15851,-15835,-15819,-15803,-15787,-15771,-15755,-15739,-15723,-15707,-15691,-15675,-15659,-15643,-15627,-15611,-15595,-15579,-15563,-15547,-15531,-15515,-15499,-15483,-15467,-15451,-15435,-15419,-15403,-15387,-15371,-15355,-15339,-15323,-15307,-15291,-15275,-15259,-15243,-15227,-15211,-15195,-15179,-15163,-15147,-15131,-15115,-15099,-15083,-15067,-15051,-15035,-15019,-15003,-14987,-14971,-14955,-14939,-14923,-14907,-14891,-14875,-14859,-14843,-14827,-14811,-14795,-14779,-14763,-14747,-14731,-14715,-14699,-14683,-14667,-14651,-14635,-14619,-14603,-14587,-14571,-14555,-14539,-14523,-14507,-14491,-14475,-14459,-14443,-14427,-14411,-14395,-14379,-14363,-14347,-14331,-14315,-14299,-14283,-14267,-14251,-14235,-14219,-14203,-14187,-14171,-14155,-14139,-14123,-14107,-14091,-14075,-14059,-14043,-14027,-14011,-13995,-13979,-13963,-13947,-13931,-13915,-13899,-13883,-13867,-13851,-13835,-13819,-13803,-13787,-13771,-13755,-13739,-13723,-13707,-13691,-13675,-13659,-13643,-13627,-13611,-13595,-13579,-13563,-13547,-13531,-13515,-13499,-13483,-13467,-13451,-13435,-13419,-13403,-13387,-13371,-13355,-13339,-13323,-13307,-13291,-13275,-13259,-13243,-13227,-13211,-13195,-13179,-13163,-13147,-13131,-13115,-13099,-13083,-13067,-13051,-13035,-13019,-13003,-12987,-12971,-12955,-12939,-12923,-12907,-12891,-12875,-12859,-12843,-12827,-12811,-12795,-12779,-12763,-12747,-12731,-12715,-12699,-12683,-12667,-12651,-12635,-12619,-12603,-12587,-12571,-12555,-12539,-12523,-12507,-12491,-12475,-12459,-12443,-12427,-12411,-12395,-12379,-12363,-12347,-12331,-12315,-12299,-12283,-12267,-12251,-12235,-12219,-12203,-12187,-12171,-12155,-12139,-12123,-12107,-12091,-12075,-12059,-12043,-12027,-12011,-11995,-11979,-11963,-11947,-11931,-11915,-11899,-11883,-11867,-11851,-11835,-11819,-11803,-11787,-11771,-11755,-11739,-11723,-11707,-11690,-11674,-11658,-11642,-11626,-11610,-11594,-11578,-11562,-11546,-11530,-11514,-11498,-11482,-11466,-11450,-11434,-11418,-11402,-11386,-11370,-11354,-11338,-11322,-11306,-11290,-11274,-11258,-11242,-11226,-11210,-11194,-11178,-11162,-11146,-11130,-11114,-11098,-11082,-11066,-11050,-11034,-11018,-11002,-10986,-10970,-10954,-10938,-10922,-10906,-10890,-10874,-10858,-10842,-10826,-10810,-10794,-10778,-10762,-10746,-10730,-10714,-10698,-10682,-10666,-10650,-10634,-10618,-10602,-10586,-10570,-10554,-10538,-10522,-10506,-10490,-10474,-10458,-10442,-10426,-10410,-10394,-10378,-10362,-10346,-10330,-10314,-10298,-10282,-10266,-10250,-10234,-10218,-10202,-10186,-10170,-10154,-10138,-10122,-10106,-10090,-10074,-10058,-10042,-10026,-10010,-9994,-9978,-9962,-9946,-9930,-9914,-9898,-9882,-9866,-9850,-9834,-9818,-9802,-9786,-9770,-9754,-9738,-9722,-9706,-9690,-9674,-9658,-9642,-9626,-9610,-9594,-9578,-9562,-9546,-9530,-9514,-9498,-9482,-9466,-9450,-9434,-9418,-9402,-9386,-9370,-9354,-9338,-9322,-9306,-9290,-9274,-9258,-9242,-9226,-9210,-9194,-9178,-9162,-9146,-9130,-9114,-9098,-9082,-9066,-9050,-9034,-9018,-9002,-8986,-8970,-8954,-8938,-8922,-8906,-8890,-8874,-8858,-8842,-8826,-8810,-8794,-8778,-8762,-8746,-8730,-8714,-8698,-8682,-8666,-8650,-8634,-8618,-8602,-8586,-8570,-8554,-8538,-8522,-8506,-8490,-8474,-8458,-8442,-8426,-8410,-8394,-8378,-8362,-8346,-8330,-8314,-8298,-8282,-8266,-8250,-8234,-8218,-8202,-8186,-8170,-8154,-8138,-8122,-8106,-8090,-8074,-8058,-8042,-8026,-8010,-7994,-7978,-7962,-7946,-7930,-7914,-7898,-7882,-7866,-7850,-7834,-7818,-7802,-7786,-7770,-7754,-7738,-7722,-7706,-7690,-7674,-7658,-7642,-7626,-7610,-7594,-7578,-7562,-7546,-7530,-7514,-7498,-7482,-7466,-7450,-7434,-7418,-7402,-7386,-7370,-7354,-7338,-7322,-7306,-7290,-7274,-7258,-7242,-7226,-7210,-7194,-7178,-7162,-7146,-7130,-7114,-7098,-7082,-7066,-7050,-7034,-7017,-7001,-6985,-6969,-6953,-6937,-6921,-6905,-6889,-6873,-6857,-6841,-6825,-6809,-6793,-6777,-6761,-6745,-6729,-6713,-6697,-6681,-6665,-6649,-6633,-6617,-6601,-6585,-6569,-6553,-6537,-6521,-6505,-6489,-6473,-6457,-6441,-6425,-6409,-6393,-6377,-6361,-6345,-6329,-6313,-6297,-6281,-6265,-6249,-6233,-6217,-6201,-6185,-6169,-6153,-6137,-6121,-6105,-6089,-6073,-6057,-6041,-6025,-6009,-5993,-5977,-5961,-5945,-5929,-5913,-5897,-5881,-5865,-5849,-5833,-5817,-5801,-5785,-5769,-5753,-5737,-5721,-5705,-5689,-5673,-5657,-5641,-5625,-5609,-5593,-5577,-5561,-5545,-5529,-5513,-5497,-5481,-5465,-5449,-5433,-5417,-5401,-5385,-5369,-5353,-5337,-5321,-5305,-5289,-5273,-5257,-5241,-5225,-5209,-5193,-5177,-5161,-5145,-5129,-5113,-5097,-5081,-5065,-5049,-5033,-5017,-5001,-4985,-4969,-4953,-4937,-4921,-4905,-4889,-4873,-4857,-4841,-4825,-4809,-4793,-4777,-4761,-4745,-4729,-4713,-4697,-4681,-4665,-4649,-4633,-4617,-4601,-4585,-4569,-4553,-4537,-4521,-4505,-4489,-4473,-4457,-4441,-4425,-4409,-4393,-4377,-4361,-4345,-4329,-4313,-4297,-4281,-4265,-4249,-4233,-4217,-4201,-4185,-4169,-4153,-4137,-4121,-4105,-4089,-4073,-4057,-4041,-4025,-4009,-3993,-3977,-3961,-3945,-3929,-3913,-3897,-3881,-3865,-3849,-3833,-3817,-3801,-3785,-3769,-3753,-3737,-3721,-3705,-3689,-3673,-3657,-3641,-3625,-3609,-3593,-3577,-3561,-3545,-3529,-3513,-3497,-3481,-3465,-3449,-3433,-3417,-3401,-3385,-3369,-3353,-3337,-3321,-3305,-3289,-3273,-3257,-3241,-3225,-3209,-3193,-3177,-3161,-3145,-3129,-3113,-3097,-3081,-3065,-3049,-3033,-3017,-3001,-2985,-2969,-2953,-2937,-2921,-2905,-2889,-2873,-2857,-2841,-2825,-2809,-2793,-2777,-2761,-2745,-2729,-2713,-2697,-2681,-2665,-2649,-2633,-2617,-2601,-2585,-2569,-2553,-2537,-2521,-2505,-2489,-2473,-2457,-2441,-2425,-2409,-2393,-2377,-2361,-2345,-2328,-2312,-2296,-2280,-2264,-2248,-2232,-2216,-2200,-2184,-2168,-2152,-2136,-2120,-2104,-2088,-2072,-2056,-2040,-2024,-2008,-1992,-1976,-1960,-1944,-1928,-1912,-1896,-1880,-1864,-1848,-1832,-1816,-1800,-1784,-1768,-1752,-1736,-1720,-1704,-1688,-1672,-1656,-1640,-1624,-1608,-1592,-1576,-1560,-1544,-1528,-1512,-1496,-1480,-1464,-1448,-1432,-1416,-1400,-1384,-1368,-1352,-1336,-1320,-1304,-1288,-1272,-1256,-1240,-1224,-1208,-1192,-1176,-1160,-1144,-1128,-1112,-1096,-1080,-1064,-1048,-1032,-1016,-1000,-984,-968,-952,-936,-920,-904,-888,-872,-856,-840,-824,-808,-792,-776,-760,-744,-728,-712,-696,-680,-664,-648,-632,-616,-600,-584,-568,-552,-536,-520,-504,-488,-472,-456,-440,-424,-408,-392,-376,-360,-344,-328,-312,-296,-280,-264,-248,-232,-216,-200,-184,-168,-152,-136,-120,-104,-88,-72,-56,-40,-24,-8,8,24,40,56,72,88,104,120,136,152,168,184,200,216,232,248,264,280,296,312,328,344,360,376,392,408,424,440,456,472,488,504,520,536,552,568,584,600,616,632,648,664,680,696,712,728,744,760,776,792,808,824,840,856,872,888,904,920,936,952,968,984,1000,1016,1032,1048,1064,1080,1096,1112,1128,1144,1160,1176,1192,1208,1224,1240,1256,1272,1288,1304,1320,1336,1352,1368,1384,1400,1416,1432,1448,1464,1480,1496,1512,1528,1544,1560,1576,1592,1608,1624,1640,1656,1672,1688,1704,1720,1736,1752,1768,1784,1800,1816,1832,1848,1864,1880,1896,1912,1928,1944,1960,1976,1992,2008,2024,2040,2056,2072,2088,2104,2120,2136,2152,2168,2184,2200,2216,2232,2248,2264,2280,2296,2312,2328,2345,2361,2377,2393,2409,2425,2441,2457,2473,2489,2505,2521,2537,2553,2569,2585,2601,2617,2633,2649,2665,2681,2697,2713,2729,2745,2761,2777,2793,2809,2825,2841,2857,2873,2889,2905,2921,2937,2953,2969,2985,3001,3017,3033,3049,3065,3081,3097,3113,3129,3145,3161,3177,3193,3209,3225,3241,3257,3273,3289,3305,3321,3337,3353,3369,3385,3401,3417,3433,3449,3465,3481,3497,3513,3529,3545,3561,3577,3593,3609,3625,3641,3657,3673,3689,3705,3721,3737,3753,3769,3785,3801,3817,3833,3849,3865,3881,3897,3913,3929,3945,3961,3977,3993,4009,4025,4041,4057,4073,4089,4105,4121,4137,4153,4169,4185,4201,4217,4233,4249,4265,4281,4297,4313,4329,4345,4361,4377,4393,4409,4425,4441,4457,4473,4489,4505,4521,4537,4553,4569,4585,4601,4617,4633,4649,4665,4681,4697,4713,4729,4745,4761,4777,4793,4809,4825,4841,4857,4873,4889,4905,4921,4937,4953,4969,4985,5001,5017,5033,5049,5065,5081,5097,5113,5129,5145,5161,5177,5193,5209,5225,5241,5257,5273,5289,5305,5321,5337,5353,5369,5385,5401,5417,5433,5449,5465,5481,5497,5513,5529,5545,5561,5577,5593,5609,5625,5641,5657,5673,5689,5705,5721,5737,5753,5769,5785,5801,5817,5833,5849,5865,5881,5897,5913,5929,5945,5961,5977,5993,6009,6025,6041,6057,6073,6089,6105,6121,6137,6153,6169,6185,6201,6217,6233,6249,6265,6281,6297,6313,6329,6345,6361,6377,6393,6409,6425,6441,6457,6473,6489,6505,6521,6537,6553,6569,6585,6601,6617,6633,6649,6665,6681,6697,6713,6729,6745,6761,6777,6793,6809,6825,6841,6857,6873,6889,6905,6921,6937,6953,6969,6985,7001,7017,7034,7050,7066,7082,7098,7114,7130,7146,7162,7178,7194,7210,7226,7242,7258,7274,7290,7306,7322,7338,7354,7370,7386,7402,7418,7434,7450,7466,7482,7498,7514,7530,7546,7562,7578,7594,7610,7626,7642,7658,7674,7690,7706,7722,7738,7754,7770,7786,7802,7818,7834,7850,7866,7882,7898,7914,7930,7946,7962,7978,7994,8010,8026,8042,8058,8074,8090,8106,8122,8138,8154,8170,8186,8202,8218,8234,8250,8266,8282,8298,8314,8330,8346,8362,8378,8394,8410,8426,8442,8458,8474,8490,8506,8522,8538,8554,8570,8586,8602,8618,8634,8650,8666,8682,8698,8714,8730,8746,8762,8778,8794,8810,8826,8842,8858,8874,8890,8906,8922,8938,8954,8970,8986,9002,9018,9034,9050,9066,9082,9098,9114,9130,9146,9162,9178,9194,9210,9226,9242,9258,9274,9290,9306,9322,9338,9354,9370,9386,9402,9418,9434,9450,9466,9482,9498,9514,9530,9546,9562,9578,9594,9610,9626,9642,9658,9674,9690,9706,9722,9738,9754,9770,9786,9802,9818,9834,9850,9866,9882,9898,9914,9930,9946,9962,9978,9994,10010,10026,10042,10058,10074,10090,10106,10122,10138,10154,10170,10186,10202,10218,10234,10250,10266,10282,10298,10314,10330,10346,10362,10378,10394,10410,10426,10442,10458,10474,10490,10506,10522,10538,10554,10570,10586,10602,10618,10634,10650,10666,10682,10698,10714,10730,10746,10762,10778,10794,10810,10826,10842,10858,10874,10890,10906,10922,10938,10954,10970,10986,11002,11018,11034,11050,11066,11082,11098,11114,11130,11146,11162,11178,11194,11210,11226,11242,11258,11274,11290,11306,11322,11338,11354,11370,11386,11402,11418,11434,11450,11466,11482,11498,11514,11530,11546,11562,11578,11594,11610,11626,11642,11658,11674,11690,11707,11723,11739,11755,11771,11787,11803,11819,11835,11851,11867,11883,11899,11915,11931,11947,11963,11979,11995,12011,12027,12043,12059,12075,12091,12107,12123,12139,12155,12171,12187,12203,12219,12235,12251,12267,12283,12299,12315,12331,12347,12363,12379,12395,12411,12427,12443,12459,12475,12491,12507,12523,12539,12555,12571,12587,12603,12619,12635,12651,12667,12683,12699,12715,12731,12747,12763,12779,12795,12811,12827,12843,12859,12875,12891,12907,12923,12939,12955,12971,12987,13003,13019,13035,13051,13067,13083,13099,13115,13131,13147,13163,13179,13195,13211,13227,13243,13259,13275,13291,13307,13323,13339,13355,13371,13387,13403,13419,13435,13451,13467,13483,13499,13515,13531,13547,13563,13579,13595,13611,13627,13643,13659,13675,13691,13707,13723,13739,13755,13771,13787,13803,13819,13835,13851,13867,13883,13899,13915,13931,13947,13963,13979,13995,14011,14027,14043,14059,14075,14091,14107,14123,14139,14155,14171,14187,14203,14219,14235,14251,14267,14283,14299,14315,14331,14347,14363,14379,14395,14411,14427,14443,14459,14475,14491,14507,14523,14539,14555,14571,14587,14603,14619,14635,14651,14667,14683,14699,14715,14731,14747,14763,14779,14795,14811,14827,14843,14859,14875,14891,14907,14923,14939,14955,14971,14987,15003,15019,15035,15051,15067,15083,15099,15115,15131,15147,15163,15179,15195,15211,15227,15243,15259,15275,15291,15307,15323,15339,15355,15371,15387,15403,15419,15435,15451,15467,15483,15499,15515,15531,15547,15563,15579,15595,15611,15627,15643,15659,15675,15691,15707,15723,15739,15755,15771,15787,15803,15819,15835,15851,15867,15883,15899,15915,15931,15947,15963,15979,15995,16011,16027,16043,16059,16075,16091,16107,16123,16139,16155,16171,16187,16203,16219,16235,16251,16267,16283,16299,16315,16331,16347,16363,16379,16396,16412,16428,16444,16460,16476,16492,16508,16524,16540,16556,16572,16588,16604,16620,16636,16652,16668,16684,16700,16716,16732,16748,16764,16780,16796,16812,16828,16844,16860,16876,16892,16908,16924,16940,16956,16972,16988,17004,17020,17036,17052,17068,17084,17100,17116,17132,17148,17164,17180,17196,17212,17228,17244,17260,17276,17292,17308,17324,17340,17356,17372,17388,17404,17420,17436,17452,17468,17484,17500,17516,17532,17548,17564,17580,17596,17612,17628,17644,17660,17676,17692,17708,17724,17740,17756,17772,17788,17804,17820,17836,17852,17868,17884,17900,17916,17932,17948,17964,17980,17996,18012,18028,18044,18060,18076,18092,18108,18124,18140,18156,18172,18188,18204,18220,18236,18252,18268,18284,18300,18316,18332,18348,18364,18380,18396,18412,18428,18444,18460,18476,18492,18508,18524,18540,18556,18572,18588,18604,18620,18636,18652,18668,18684,18700,18716,18732,18748,18764,18780,18796,18812,18828,18844,18860,18876,18892,18908,18924,18940,18956,18972,18988,19004,19020,19036,19052,19068,19084,19100,19116,19132,19148,19164,19180,19196,19212,19228,19244,19260,19276,19292,19308,19324,19340,19356,19372,19388,19404,19420,19436,19452,19468,19484,19500,19516,19532,19548,19564,19580,19596,19612,19628,19644,19660,19676,19692,19708,19724,19740,19756,19772,19788,19804,19820,19836,19852,19868,19884,19900,19916,19932,19948,19964,19980,19996,20012,20028,20044,20060,20076,20092,20108,20124,20140,20156,20172,20188,20204,20220,20236,20252,20268,20284,20300,20316,20332,20348,20364,20380,20396,20412,20428,20444,20460,20476,20492,20508,20524,20540,20556,20572,20588,20604,20620,20636,20652,20668,20684,20700,20716,20732,20748,20764,20780,20796,20812,20828,20844,20860,20876,20892,20908,20924,20940,20956,20972,20988,21004,21020,21036,21052,21069,21085,21101,21117,21133,21149,21165,21181,21197,21213,21229,21245,21261,21277,21293,21309,21325,21341,21357,21373,21389,21405,21421,21437,21453,21469,21485,21501,21517,21533,21549,21565,21581,21597,21613,21629,21645,21661,21677,21693,21709,21725,21741,21757,21773,21789,21805,21821,21837,21853,21869,21885,21901,21917,21933,21949,21965,21981,21997,22013,22029,22045,22061,22077,22093,22109,22125,22141,22157,22173,22189,22205,22221,22237,22253,22269,22285,22301,22317,22333,22349,22365,22381,22397,22413,22429,22445,22461,22477,22493,22509,22525,22541,22557,22573,22589,22605,22621,22637,22653,22669,22685,22701,22717,22733,22749,22765,22781,22797,22813,22829,22845,22861,22877,22893,22909,22925,22941,22957,22973,22989,23005,23021,23037,23053,23069,23085,23101,23117,23133,23149,23165,23181,23197,23213,23229,23245,23261,23277,23293,23309,23325,23341,23357,23373,23389,23405,23421,23437,23453,23469,23485,23501,23517,23533,23549,23565,23581,23597,23613,23629,23645,23661,23677,23693,23709,23725,23741,23757,23773,23789,23805,23821,23837,23853,23869,23885,23901,23917,23933,23949,23965,23981,23997,24013,24029,24045,24061,24077,24093,24109,24125,24141,24157,24173,24189,24205,24221,24237,24253,24269,24285,24301,24317,24333,24349,24365,24381,24397,24413,24429,24445,24461,24477,24493,24509,24525,24541,24557,24573,24589,24605,24621,24637,24653,24669,24685,24701,24717,24733,24749,24765,24781,24797,24813,24829,24845,24861,24877,24893,24909,24925,24941,24957,24973,24989,25005,25021,25037,25053,25069,25085,25101,25117,25133,25149,25165,25181,25197,25213,25229,25245,25261,25277,25293,25309,25325,25341,25357,25373,25389,25405,25421,25437,25453,25469,25485,25501,25517,25533,25549,25565,25581,25597,25613,25629,25645,25661,25677,25693,25709,25725,25741,25758,25774,25790,25806,25822,25838,25854,25870,25886,25902,25918,25934,25950,25966,25982,25998,26014,26030,26046,26062,26078,26094,26110,26126,26142,26158,26174,26190,26206,26222,26238,26254,26270,26286,26302,26318,26334,26350,26366,26382,26398,26414,26430,26446,26462,26478,26494,26510,26526,26542,26558,26574,26590,26606,26622,26638,26654,26670,26686,26702,26718,26734,26750,26766,26782,26798,26814,26830,26846,26862,26878,26894,26910,26926,26942,26958,26974,26990,27006,27022,27038,27054,27070,27086,27102,27118,27134,27150,27166,27182,27198,27214,27230,27246,27262,27278,27294,27310,27326,27342,27358,27374,27390,27406,27422,27438,27454,27470,27486,27502,27518,27534,27550,27566,27582,27598,27614,27630,27646,27662,27678,27694,27710,27726,27742,27758,27774,27790,27806,27822,27838,27854,27870,27886,27902,27918,27934,27950,27966,27982,27998,28014,28030,28046,28062,28078,28094,28110,28126,28142,28158,28174,28190,28206,28222,28238,28254,28270,28286,28302,28318,28334,28350,28366,28382,28398,28414,28430,28446,28462,28478,28494,28510,28526,28542,28558,28574,28590,28606,28622,28638,28654,28670,28686,28702,28718,28734,28750,28766,28782,28798,28814,28830,28846,28862,28878,28894,28910,28926,28942,28958,28974,28990,29006,29022,29038,29054,29070,29086,29102,29118,29134,29150,29166,29182,29198,29214,29230,29246,29262,29278,29294,29310,29326,29342,29358,29374,29390,29406,29422,29438,29454,29470,29486,29502,29518,29534,29550,29566,29582,29598,29614,29630,29646,29662,29678,29694,29710,29726,29742,29758,29774,29790,29806,29822,29838,29854,29870,29886,29902,29918,29934,29950,29966,29982,29998,30014,30030,30046,30062,30078,30094,30110,30126,30142,30158,30174,30190,30206,30222,30238,30254,30270,30286,30302,30318,30334,30350,30366,30382,30398,30414,30431,30447,30463,30479,30495,30511,30527,30543,30559,30575,30591,30607,30623,30639,30655,30671,30687,30703,30719,30735,30751,30767,30783,30799,30815,30831,30847,30863,30879,30895,30911,30927,30943,30959,30975,30991,31007,31023,31039,31055,31071,31087,31103,31119,31135,31151,31167,31183,31199,31215,31231,31247,31263,31279,31295,31311,31327,31343,31359,31375,31391,31407,31423,31439,31455,31471,31487,31503,31519,31535,31551,31567,31583,31599,31615,31631,31647,31663,31679,31695,31711,31727,31743,31759,31775,31791,31807,31823,31839,31855,31871,31887,31903,31919,31935,31951,31967,31983,31999,32015,32031,32047,32063,32079,32095,32111,32127,32143,32159,32175,32191,32207,32223,32239,32255,32271,32287,32303,32319,32335,32351,32367,32383,32399,32415,32431,32447,32463,32479,32495,32511,32527,32543,32559,32575,32591,32607,32623,32639,32655,32671,32687,32703,32719,32735,32751,32767};
-static const fp_t triangle_table[] = {32767,32735,32703,32671,32639,32607,32575,32543,32511,32479,32447,32415,32383,32351,32319,32287,32255,32223,32191,32159,32127,32095,32063,32031,31999,31967,31935,31903,31871,31839,31807,31775,31743,31711,31679,31647,31615,31583,31551,31519,31487,31455,31423,31391,31359,31327,31295,31263,31231,31199,31167,31135,31103,31071,31039,31007,30975,30943,30911,30879,30847,30815,30783,30751,30719,30687,30655,30623,30591,30559,30527,30495,30463,30431,30398,30366,30334,30302,30270,30238,30206,30174,30142,30110,30078,30046,30014,29982,29950,29918,29886,29854,29822,29790,29758,29726,29694,29662,29630,29598,29566,29534,29502,29470,29438,29406,29374,29342,29310,29278,29246,29214,29182,29150,29118,29086,29054,29022,28990,28958,28926,28894,28862,28830,28798,28766,28734,28702,28670,28638,28606,28574,28542,28510,28478,28446,28414,28382,28350,28318,28286,28254,28222,28190,28158,28126,28094,28062,28030,27998,27966,27934,27902,27870,27838,27806,27774,27742,27710,27678,27646,27614,27582,27550,27518,27486,27454,27422,27390,27358,27326,27294,27262,27230,27198,27166,27134,27102,27070,27038,27006,26974,26942,26910,26878,26846,26814,26782,26750,26718,26686,26654,26622,26590,26558,26526,26494,26462,26430,26398,26366,26334,26302,26270,26238,26206,26174,26142,26110,26078,26046,26014,25982,25950,25918,25886,25854,25822,25790,25758,25725,25693,25661,25629,25597,25565,25533,25501,25469,25437,25405,25373,25341,25309,25277,25245,25213,25181,25149,25117,25085,25053,25021,24989,24957,24925,24893,24861,24829,24797,24765,24733,24701,24669,24637,24605,24573,24541,24509,24477,24445,24413,24381,24349,24317,24285,24253,24221,24189,24157,24125,24093,24061,24029,23997,23965,23933,23901,23869,23837,23805,23773,23741,23709,23677,23645,23613,23581,23549,23517,23485,23453,23421,23389,23357,23325,23293,23261,23229,23197,23165,23133,23101,23069,23037,23005,22973,22941,22909,22877,22845,22813,22781,22749,22717,22685,22653,22621,22589,22557,22525,22493,22461,22429,22397,22365,22333,22301,22269,22237,22205,22173,22141,22109,22077,22045,22013,21981,21949,21917,21885,21853,21821,21789,21757,21725,21693,21661,21629,21597,21565,21533,21501,21469,21437,21405,21373,21341,21309,21277,21245,21213,21181,21149,21117,21085,21052,21020,20988,20956,20924,20892,20860,20828,20796,20764,20732,20700,20668,20636,20604,20572,20540,20508,20476,20444,20412,20380,20348,20316,20284,20252,20220,20188,20156,20124,20092,20060,20028,19996,19964,19932,19900,19868,19836,19804,19772,19740,19708,19676,19644,19612,19580,19548,19516,19484,19452,19420,19388,19356,19324,19292,19260,19228,19196,19164,19132,19100,19068,19036,19004,18972,18940,18908,18876,18844,18812,18780,18748,18716,18684,18652,18620,18588,18556,18524,18492,18460,18428,18396,18364,18332,18300,18268,18236,18204,18172,18140,18108,18076,18044,18012,17980,17948,17916,17884,17852,17820,17788,17756,17724,17692,17660,17628,17596,17564,17532,17500,17468,17436,17404,17372,17340,17308,17276,17244,17212,17180,17148,17116,17084,17052,17020,16988,16956,16924,16892,16860,16828,16796,16764,16732,16700,16668,16636,16604,16572,16540,16508,16476,16444,16412,16379,16347,16315,16283,16251,16219,16187,16155,16123,16091,16059,16027,15995,15963,15931,15899,15867,15835,15803,15771,15739,15707,15675,15643,15611,15579,15547,15515,15483,15451,15419,15387,15355,15323,15291,15259,15227,15195,15163,15131,15099,15067,15035,15003,14971,14939,14907,14875,14843,14811,14779,14747,14715,14683,14651,14619,14587,14555,14523,14491,14459,14427,14395,14363,14331,14299,14267,14235,14203,14171,14139,14107,14075,14043,14011,13979,13947,13915,13883,13851,13819,13787,13755,13723,13691,13659,13627,13595,13563,13531,13499,13467,13435,13403,13371,13339,13307,13275,13243,13211,13179,13147,13115,13083,13051,13019,12987,12955,12923,12891,12859,12827,12795,12763,12731,12699,12667,12635,12603,12571,12539,12507,12475,12443,12411,12379,12347,12315,12283,12251,12219,12187,12155,12123,12091,12059,12027,11995,11963,11931,11899,11867,11835,11803,11771,11739,11707,11674,11642,11610,11578,11546,11514,11482,11450,11418,11386,11354,11322,11290,11258,11226,11194,11162,11130,11098,11066,11034,11002,10970,10938,10906,10874,10842,10810,10778,10746,10714,10682,10650,10618,10586,10554,10522,10490,10458,10426,10394,10362,10330,10298,10266,10234,10202,10170,10138,10106,10074,10042,10010,9978,9946,9914,9882,9850,9818,9786,9754,9722,9690,9658,9626,9594,9562,9530,9498,9466,9434,9402,9370,9338,9306,9274,9242,9210,9178,9146,9114,9082,9050,9018,8986,8954,8922,8890,8858,8826,8794,8762,8730,8698,8666,8634,8602,8570,8538,8506,8474,8442,8410,8378,8346,8314,8282,8250,8218,8186,8154,8122,8090,8058,8026,7994,7962,7930,7898,7866,7834,7802,7770,7738,7706,7674,7642,7610,7578,7546,7514,7482,7450,7418,7386,7354,7322,7290,7258,7226,7194,7162,7130,7098,7066,7034,7001,6969,6937,6905,6873,6841,6809,6777,6745,6713,6681,6649,6617,6585,6553,6521,6489,6457,6425,6393,6361,6329,6297,6265,6233,6201,6169,6137,6105,6073,6041,6009,5977,5945,5913,5881,5849,5817,5785,5753,5721,5689,5657,5625,5593,5561,5529,5497,5465,5433,5401,5369,5337,5305,5273,5241,5209,5177,5145,5113,5081,5049,5017,4985,4953,4921,4889,4857,4825,4793,4761,4729,4697,4665,4633,4601,4569,4537,4505,4473,4441,4409,4377,4345,4313,4281,4249,4217,4185,4153,4121,4089,4057,4025,3993,3961,3929,3897,3865,3833,3801,3769,3737,3705,3673,3641,3609,3577,3545,3513,3481,3449,3417,3385,3353,3321,3289,3257,3225,3193,3161,3129,3097,3065,3033,3001,2969,2937,2905,2873,2841,2809,2777,2745,2713,2681,2649,2617,2585,2553,2521,2489,2457,2425,2393,2361,2328,2296,2264,2232,2200,2168,2136,2104,2072,2040,2008,1976,1944,1912,1880,1848,1816,1784,1752,1720,1688,1656,1624,1592,1560,1528,1496,1464,1432,1400,1368,1336,1304,1272,1240,1208,1176,1144,1112,1080,1048,1016,984,952,920,888,856,824,792,760,728,696,664,632,600,568,536,504,472,440,408,376,344,312,280,248,216,184,152,120,88,56,24,-8,-40,-72,-104,-136,-168,-200,-232,-264,-296,-328,-360,-392,-424,-456,-488,-520,-552,-584,-616,-648,-680,-712,-744,-776,-808,-840,-872,-904,-936,-968,-1000,-1032,-1064,-1096,-1128,-1160,-1192,-1224,-1256,-1288,-1320,-1352,-1384,-1416,-1448,-1480,-1512,-1544,-1576,-1608,-1640,-1672,-1704,-1736,-1768,-1800,-1832,-1864,-1896,-1928,-1960,-1992,-2024,-2056,-2088,-2120,-2152,-2184,-2216,-2248,-2280,-2312,-2345,-2377,-2409,-2441,-2473,-2505,-2537,-2569,-2601,-2633,-2665,-2697,-2729,-2761,-2793,-2825,-2857,-2889,-2921,-2953,-2985,-3017,-3049,-3081,-3113,-3145,-3177,-3209,-3241,-3273,-3305,-3337,-3369,-3401,-3433,-3465,-3497,-3529,-3561,-3593,-3625,-3657,-3689,-3721,-3753,-3785,-3817,-3849,-3881,-3913,-3945,-3977,-4009,-4041,-4073,-4105,-4137,-4169,-4201,-4233,-4265,-4297,-4329,-4361,-4393,-4425,-4457,-4489,-4521,-4553,-4585,-4617,-4649,-4681,-4713,-4745,-4777,-4809,-4841,-4873,-4905,-4937,-4969,-5001,-5033,-5065,-5097,-5129,-5161,-5193,-5225,-5257,-5289,-5321,-5353,-5385,-5417,-5449,-5481,-5513,-5545,-5577,-5609,-5641,-5673,-5705,-5737,-5769,-5801,-5833,-5865,-5897,-5929,-5961,-5993,-6025,-6057,-6089,-6121,-6153,-6185,-6217,-6249,-6281,-6313,-6345,-6377,-6409,-6441,-6473,-6505,-6537,-6569,-6601,-6633,-6665,-6697,-6729,-6761,-6793,-6825,-6857,-6889,-6921,-6953,-6985,-7017,-7050,-7082,-7114,-7146,-7178,-7210,-7242,-7274,-7306,-7338,-7370,-7402,-7434,-7466,-7498,-7530,-7562,-7594,-7626,-7658,-7690,-7722,-7754,-7786,-7818,-7850,-7882,-7914,-7946,-7978,-8010,-8042,-8074,-8106,-8138,-8170,-8202,-8234,-8266,-8298,-8330,-8362,-8394,-8426,-8458,-8490,-8522,-8554,-8586,-8618,-8650,-8682,-8714,-8746,-8778,-8810,-8842,-8874,-8906,-8938,-8970,-9002,-9034,-9066,-9098,-9130,-9162,-9194,-9226,-9258,-9290,-9322,-9354,-9386,-9418,-9450,-9482,-9514,-9546,-9578,-9610,-9642,-9674,-9706,-9738,-9770,-9802,-9834,-9866,-9898,-9930,-9962,-9994,-10026,-10058,-10090,-10122,-10154,-10186,-10218,-10250,-10282,-10314,-10346,-10378,-10410,-10442,-10474,-10506,-10538,-10570,-10602,-10634,-10666,-10698,-10730,-10762,-10794,-10826,-10858,-10890,-10922,-10954,-10986,-11018,-11050,-11082,-11114,-11146,-11178,-11210,-11242,-11274,-11306,-11338,-11370,-11402,-11434,-11466,-11498,-11530,-11562,-11594,-11626,-11658,-11690,-11723,-11755,-11787,-11819,-11851,-11883,-11915,-11947,-11979,-12011,-12043,-12075,-12107,-12139,-12171,-12203,-12235,-12267,-12299,-12331,-12363,-12395,-12427,-12459,-12491,-12523,-12555,-12587,-12619,-12651,-12683,-12715,-12747,-12779,-12811,-12843,-12875,-12907,-12939,-12971,-13003,-13035,-13067,-13099,-13131,-13163,-13195,-13227,-13259,-13291,-13323,-13355,-13387,-13419,-13451,-13483,-13515,-13547,-13579,-13611,-13643,-13675,-13707,-13739,-13771,-13803,-13835,-13867,-13899,-13931,-13963,-13995,-14027,-14059,-14091,-14123,-14155,-14187,-14219,-14251,-14283,-14315,-14347,-14379,-14411,-14443,-14475,-14507,-14539,-14571,-14603,-14635,-14667,-14699,-14731,-14763,-14795,-14827,-14859,-14891,-14923,-14955,-14987,-15019,-15051,-15083,-15115,-15147,-15179,-15211,-15243,-15275,-15307,-15339,-15371,-15403,-15435,-15467,-15499,-15531,-15563,-15595,-15627,-15659,-15691,-15723,-15755,-15787,-15819,-15851,-15883,-15915,-15947,-15979,-16011,-16043,-16075,-16107,-16139,-16171,-16203,-16235,-16267,-16299,-16331,-16363,-16396,-16428,-16460,-16492,-16524,-16556,-16588,-16620,-16652,-16684,-16716,-16748,-16780,-16812,-16844,-16876,-16908,-16940,-16972,-17004,-17036,-17068,-17100,-17132,-17164,-17196,-17228,-17260,-17292,-17324,-17356,-17388,-17420,-17452,-17484,-17516,-17548,-17580,-17612,-17644,-17676,-17708,-17740,-17772,-17804,-17836,-17868,-17900,-17932,-17964,-17996,-18028,-18060,-18092,-18124,-18156,-18188,-18220,-18252,-18284,-18316,-18348,-18380,-18412,-18444,-18476,-18508,-18540,-18572,-18604,-18636,-18668,-18700,-18732,-18764,-18796,-18828,-18860,-18892,-18924,-18956,-18988,-19020,-19052,-19084,-19116,-19148,-19180,-19212,-19244,-19276,-19308,-19340,-19372,-19404,-19436,-19468,-19500,-19532,-19564,-19596,-19628,-19660,-19692,-19724,-19756,-19788,-19820,-19852,-19884,-19916,-19948,-19980,-20012,-20044,-20076,-20108,-20140,-20172,-20204,-20236,-20268,-20300,-20332,-20364,-20396,-20428,-20460,-20492,-20524,-20556,-20588,-20620,-20652,-20684,-20716,-20748,-20780,-20812,-20844,-20876,-20908,-20940,-20972,-21004,-21036,-21069,-21101,-21133,-21165,-21197,-21229,-21261,-21293,-21325,-21357,-21389,-21421,-21453,-21485,-21517,-21549,-21581,-21613,-21645,-21677,-21709,-21741,-21773,-21805,-21837,-21869,-21901,-21933,-21965,-21997,-22029,-22061,-22093,-22125,-22157,-22189,-22221,-22253,-22285,-22317,-22349,-22381,-22413,-22445,-22477,-22509,-22541,-22573,-22605,-22637,-22669,-22701,-22733,-22765,-22797,-22829,-22861,-22893,-22925,-22957,-22989,-23021,-23053,-23085,-23117,-23149,-23181,-23213,-23245,-23277,-23309,-23341,-23373,-23405,-23437,-23469,-23501,-23533,-23565,-23597,-23629,-23661,-23693,-23725,-23757,-23789,-23821,-23853,-23885,-23917,-23949,-23981,-24013,-24045,-24077,-24109,-24141,-24173,-24205,-24237,-24269,-24301,-24333,-24365,-24397,-24429,-24461,-24493,-24525,-24557,-24589,-24621,-24653,-24685,-24717,-24749,-24781,-24813,-24845,-24877,-24909,-24941,-24973,-25005,-25037,-25069,-25101,-25133,-25165,-25197,-25229,-25261,-25293,-25325,-25357,-25389,-25421,-25453,-25485,-25517,-25549,-25581,-25613,-25645,-25677,-25709,-25741,-25774,-25806,-25838,-25870,-25902,-25934,-25966,-25998,-26030,-26062,-26094,-26126,-26158,-26190,-26222,-26254,-26286,-26318,-26350,-26382,-26414,-26446,-26478,-26510,-26542,-26574,-26606,-26638,-26670,-26702,-26734,-26766,-26798,-26830,-26862,-26894,-26926,-26958,-26990,-27022,-27054,-27086,-27118,-27150,-27182,-27214,-27246,-27278,-27310,-27342,-27374,-27406,-27438,-27470,-27502,-27534,-27566,-27598,-27630,-27662,-27694,-27726,-27758,-27790,-27822,-27854,-27886,-27918,-27950,-27982,-28014,-28046,-28078,-28110,-28142,-28174,-28206,-28238,-28270,-28302,-28334,-28366,-28398,-28430,-28462,-28494,-28526,-28558,-28590,-28622,-28654,-28686,-28718,-28750,-28782,-28814,-28846,-28878,-28910,-28942,-28974,-29006,-29038,-29070,-29102,-29134,-29166,-29198,-29230,-29262,-29294,-29326,-29358,-29390,-29422,-29454,-29486,-29518,-29550,-29582,-29614,-29646,-29678,-29710,-29742,-29774,-29806,-29838,-29870,-29902,-29934,-29966,-29998,-30030,-30062,-30094,-30126,-30158,-30190,-30222,-30254,-30286,-30318,-30350,-30382,-30414,-30447,-30479,-30511,-30543,-30575,-30607,-30639,-30671,-30703,-30735,-30767,-30799,-30831,-30863,-30895,-30927,-30959,-30991,-31023,-31055,-31087,-31119,-31151,-31183,-31215,-31247,-31279,-31311,-31343,-31375,-31407,-31439,-31471,-31503,-31535,-31567,-31599,-31631,-31663,-31695,-31727,-31759,-31791,-31823,-31855,-31887,-31919,-31951,-31983,-32015,-32047,-32079,-32111,-32143,-32175,-32207,-32239,-32271,-32303,-32335,-32367,-32399,-32431,-32463,-32495,-32527,-32559,-32591,-32623,-32655,-32687,-32719,-32751,-32751,-32719,-32687,-32655,-32623,-32591,-32559,-32527,-32495,-32463,-32431,-32399,-32367,-32335,-32303,-32271,-32239,-32207,-32175,-32143,-32111,-32079,-32047,-32015,-31983,-31951,-31919,-31887,-31855,-31823,-31791,-31759,-31727,-31695,-31663,-31631,-31599,-31567,-31535,-31503,-31471,-31439,-31407,-31375,-31343,-31311,-31279,-31247,-31215,-31183,-31151,-31119,-31087,-31055,-31023,-30991,-30959,-30927,-30895,-30863,-30831,-30799,-30767,-30735,-30703,-30671,-30639,-30607,-30575,-30543,-30511,-30479,-30447,-30414,-30382,-30350,-30318,-30286,-30254,-30222,-30190,-30158,-30126,-30094,-30062,-30030,-29998,-29966,-29934,-29902,-29870,-29838,-29806,-29774,-29742,-29710,-29678,-29646,-29614,-29582,-29550,-29518,-29486,-29454,-29422,-29390,-29358,-29326,-29294,-29262,-29230,-29198,-29166,-29134,-29102,-29070,-29038,-29006,-28974,-28942,-28910,-28878,-28846,-28814,-28782,-28750,-28718,-28686,-28654,-28622,-28590,-28558,-28526,-28494,-28462,-28430,-28398,-28366,-28334,-28302,-28270,-28238,-28206,-28174,-28142,-28110,-28078,-28046,-28014,-27982,-27950,-27918,-27886,-27854,-27822,-27790,-27758,-27726,-27694,-27662,-27630,-27598,-27566,-27534,-27502,-27470,-27438,-27406,-27374,-27342,-27310,-27278,-27246,-27214,-27182,-27150,-27118,-27086,-27054,-27022,-26990,-26958,-26926,-26894,-26862,-26830,-26798,-26766,-26734,-26702,-26670,-26638,-26606,-26574,-26542,-26510,-26478,-26446,-26414,-26382,-26350,-26318,-26286,-26254,-26222,-26190,-26158,-26126,-26094,-26062,-26030,-25998,-25966,-25934,-25902,-25870,-25838,-25806,-25774,-25741,-25709,-25677,-25645,-25613,-25581,-25549,-25517,-25485,-25453,-25421,-25389,-25357,-25325,-25293,-25261,-25229,-25197,-25165,-25133,-25101,-25069,-25037,-25005,-24973,-24941,-24909,-24877,-24845,-24813,-24781,-24749,-24717,-24685,-24653,-24621,-24589,-24557,-24525,-24493,-24461,-24429,-24397,-24365,-24333,-24301,-24269,-24237,-24205,-24173,-24141,-24109,-24077,-24045,-24013,-23981,-23949,-23917,-23885,-23853,-23821,-23789,-23757,-23725,-23693,-23661,-23629,-23597,-23565,-23533,-23501,-23469,-23437,-23405,-23373,-23341,-23309,-23277,-23245,-23213,-23181,-23149,-23117,-23085,-23053,-23021,-22989,-22957,-22925,-22893,-22861,-22829,-22797,-22765,-22733,-22701,-22669,-22637,-22605,-22573,-22541,-22509,-22477,-22445,-22413,-22381,-22349,-22317,-22285,-22253,-22221,-22189,-22157,-22125,-22093,-22061,-22029,-21997,-21965,-21933,-21901,-21869,-21837,-21805,-21773,-21741,-21709,-21677,-21645,-21613,-21581,-21549,-21517,-21485,-21453,-21421,-21389,-21357,-21325,-21293,-21261,-21229,-21197,-21165,-21133,-21101,-21069,-21036,-21004,-20972,-20940,-20908,-20876,-20844,-20812,-20780,-20748,-20716,-20684,-20652,-20620,-20588,-20556,-20524,-20492,-20460,-20428,-20396,-20364,-20332,-20300,-20268,-20236,-20204,-20172,-20140,-20108,-20076,-20044,-20012,-19980,-19948,-19916,-19884,-19852,-19820,-19788,-19756,-19724,-19692,-19660,-19628,-19596,-19564,-19532,-19500,-19468,-19436,-19404,-19372,-19340,-19308,-19276,-19244,-19212,-19180,-19148,-19116,-19084,-19052,-19020,-18988,-18956,-18924,-18892,-18860,-18828,-18796,-18764,-18732,-18700,-18668,-18636,-18604,-18572,-18540,-18508,-18476,-18444,-18412,-18380,-18348,-18316,-18284,-18252,-18220,-18188,-18156,-18124,-18092,-18060,-18028,-17996,-17964,-17932,-17900,-17868,-17836,-17804,-17772,-17740,-17708,-17676,-17644,-17612,-17580,-17548,-17516,-17484,-17452,-17420,-17388,-17356,-17324,-17292,-17260,-17228,-17196,-17164,-17132,-17100,-17068,-17036,-17004,-16972,-16940,-16908,-16876,-16844,-16812,-16780,-16748,-16716,-16684,-16652,-16620,-16588,-16556,-16524,-16492,-16460,-16428,-16396,-16363,-16331,-16299,-16267,-16235,-16203,-16171,-16139,-16107,-16075,-16043,-16011,-15979,-15947,-15915,-15883,-15851,-15819,-15787,-15755,-15723,-15691,-15659,-15627,-15595,-15563,-15531,-15499,-15467,-15435,-15403,-15371,-15339,-15307,-15275,-15243,-15211,-15179,-15147,-15115,-15083,-15051,-15019,-14987,-14955,-14923,-14891,-14859,-14827,-14795,-14763,-14731,-14699,-14667,-14635,-14603,-14571,-14539,-14507,-14475,-14443,-14411,-14379,-14347,-14315,-14283,-14251,-14219,-14187,-14155,-14123,-14091,-14059,-14027,-13995,-13963,-13931,-13899,-13867,-13835,-13803,-13771,-13739,-13707,-13675,-13643,-13611,-13579,-13547,-13515,-13483,-13451,-13419,-13387,-13355,-13323,-13291,-13259,-13227,-13195,-13163,-13131,-13099,-13067,-13035,-13003,-12971,-12939,-12907,-12875,-12843,-12811,-12779,-12747,-12715,-12683,-12651,-12619,-12587,-12555,-12523,-12491,-12459,-12427,-12395,-12363,-12331,-12299,-12267,-12235,-12203,-12171,-12139,-12107,-12075,-12043,-12011,-11979,-11947,-11915,-11883,-11851,-11819,-11787,-11755,-11723,-11690,-11658,-11626,-11594,-11562,-11530,-11498,-11466,-11434,-11402,-11370,-11338,-11306,-11274,-11242,-11210,-11178,-11146,-11114,-11082,-11050,-11018,-10986,-10954,-10922,-10890,-10858,-10826,-10794,-10762,-10730,-10698,-10666,-10634,-10602,-10570,-10538,-10506,-10474,-10442,-10410,-10378,-10346,-10314,-10282,-10250,-10218,-10186,-10154,-10122,-10090,-10058,-10026,-9994,-9962,-9930,-9898,-9866,-9834,-9802,-9770,-9738,-9706,-9674,-9642,-9610,-9578,-9546,-9514,-9482,-9450,-9418,-9386,-9354,-9322,-9290,-9258,-9226,-9194,-9162,-9130,-9098,-9066,-9034,-9002,-8970,-8938,-8906,-8874,-8842,-8810,-8778,-8746,-8714,-8682,-8650,-8618,-8586,-8554,-8522,-8490,-8458,-8426,-8394,-8362,-8330,-8298,-8266,-8234,-8202,-8170,-8138,-8106,-8074,-8042,-8010,-7978,-7946,-7914,-7882,-7850,-7818,-7786,-7754,-7722,-7690,-7658,-7626,-7594,-7562,-7530,-7498,-7466,-7434,-7402,-7370,-7338,-7306,-7274,-7242,-7210,-7178,-7146,-7114,-7082,-7050,-7017,-6985,-6953,-6921,-6889,-6857,-6825,-6793,-6761,-6729,-6697,-6665,-6633,-6601,-6569,-6537,-6505,-6473,-6441,-6409,-6377,-6345,-6313,-6281,-6249,-6217,-6185,-6153,-6121,-6089,-6057,-6025,-5993,-5961,-5929,-5897,-5865,-5833,-5801,-5769,-5737,-5705,-5673,-5641,-5609,-5577,-5545,-5513,-5481,-5449,-5417,-5385,-5353,-5321,-5289,-5257,-5225,-5193,-5161,-5129,-5097,-5065,-5033,-5001,-4969,-4937,-4905,-4873,-4841,-4809,-4777,-4745,-4713,-4681,-4649,-4617,-4585,-4553,-4521,-4489,-4457,-4425,-4393,-4361,-4329,-4297,-4265,-4233,-4201,-4169,-4137,-4105,-4073,-4041,-4009,-3977,-3945,-3913,-3881,-3849,-3817,-3785,-3753,-3721,-3689,-3657,-3625,-3593,-3561,-3529,-3497,-3465,-3433,-3401,-3369,-3337,-3305,-3273,-3241,-3209,-3177,-3145,-3113,-3081,-3049,-3017,-2985,-2953,-2921,-2889,-2857,-2825,-2793,-2761,-2729,-2697,-2665,-2633,-2601,-2569,-2537,-2505,-2473,-2441,-2409,-2377,-2345,-2312,-2280,-2248,-2216,-2184,-2152,-2120,-2088,-2056,-2024,-1992,-1960,-1928,-1896,-1864,-1832,-1800,-1768,-1736,-1704,-1672,-1640,-1608,-1576,-1544,-1512,-1480,-1448,-1416,-1384,-1352,-1320,-1288,-1256,-1224,-1192,-1160,-1128,-1096,-1064,-1032,-1000,-968,-936,-904,-872,-840,-808,-776,-744,-712,-680,-648,-616,-584,-552,-520,-488,-456,-424,-392,-360,-328,-296,-264,-232,-200,-168,-136,-104,-72,-40,-8,24,56,88,120,152,184,216,248,280,312,344,376,408,440,472,504,536,568,600,632,664,696,728,760,792,824,856,888,920,952,984,1016,1048,1080,1112,1144,1176,1208,1240,1272,1304,1336,1368,1400,1432,1464,1496,1528,1560,1592,1624,1656,1688,1720,1752,1784,1816,1848,1880,1912,1944,1976,2008,2040,2072,2104,2136,2168,2200,2232,2264,2296,2328,2361,2393,2425,2457,2489,2521,2553,2585,2617,2649,2681,2713,2745,2777,2809,2841,2873,2905,2937,2969,3001,3033,3065,3097,3129,3161,3193,3225,3257,3289,3321,3353,3385,3417,3449,3481,3513,3545,3577,3609,3641,3673,3705,3737,3769,3801,3833,3865,3897,3929,3961,3993,4025,4057,4089,4121,4153,4185,4217,4249,4281,4313,4345,4377,4409,4441,4473,4505,4537,4569,4601,4633,4665,4697,4729,4761,4793,4825,4857,4889,4921,4953,4985,5017,5049,5081,5113,5145,5177,5209,5241,5273,5305,5337,5369,5401,5433,5465,5497,5529,5561,5593,5625,5657,5689,5721,5753,5785,5817,5849,5881,5913,5945,5977,6009,6041,6073,6105,6137,6169,6201,6233,6265,6297,6329,6361,6393,6425,6457,6489,6521,6553,6585,6617,6649,6681,6713,6745,6777,6809,6841,6873,6905,6937,6969,7001,7034,7066,7098,7130,7162,7194,7226,7258,7290,7322,7354,7386,7418,7450,7482,7514,7546,7578,7610,7642,7674,7706,7738,7770,7802,7834,7866,7898,7930,7962,7994,8026,8058,8090,8122,8154,8186,8218,8250,8282,8314,8346,8378,8410,8442,8474,8506,8538,8570,8602,8634,8666,8698,8730,8762,8794,8826,8858,8890,8922,8954,8986,9018,9050,9082,9114,9146,9178,9210,9242,9274,9306,9338,9370,9402,9434,9466,9498,9530,9562,9594,9626,9658,9690,9722,9754,9786,9818,9850,9882,9914,9946,9978,10010,10042,10074,10106,10138,10170,10202,10234,10266,10298,10330,10362,10394,10426,10458,10490,10522,10554,10586,10618,10650,10682,10714,10746,10778,10810,10842,10874,10906,10938,10970,11002,11034,11066,11098,11130,11162,11194,11226,11258,11290,11322,11354,11386,11418,11450,11482,11514,11546,11578,11610,11642,11674,11707,11739,11771,11803,11835,11867,11899,11931,11963,11995,12027,12059,12091,12123,12155,12187,12219,12251,12283,12315,12347,12379,12411,12443,12475,12507,12539,12571,12603,12635,12667,12699,12731,12763,12795,12827,12859,12891,12923,12955,12987,13019,13051,13083,13115,13147,13179,13211,13243,13275,13307,13339,13371,13403,13435,13467,13499,13531,13563,13595,13627,13659,13691,13723,13755,13787,13819,13851,13883,13915,13947,13979,14011,14043,14075,14107,14139,14171,14203,14235,14267,14299,14331,14363,14395,14427,14459,14491,14523,14555,14587,14619,14651,14683,14715,14747,14779,14811,14843,14875,14907,14939,14971,15003,15035,15067,15099,15131,15163,15195,15227,15259,15291,15323,15355,15387,15419,15451,15483,15515,15547,15579,15611,15643,15675,15707,15739,15771,15803,15835,15867,15899,15931,15963,15995,16027,16059,16091,16123,16155,16187,16219,16251,16283,16315,16347,16379,16412,16444,16476,16508,16540,16572,16604,16636,16668,16700,16732,16764,16796,16828,16860,16892,16924,16956,16988,17020,17052,17084,17116,17148,17180,17212,17244,17276,17308,17340,17372,17404,17436,17468,17500,17532,17564,17596,17628,17660,17692,17724,17756,17788,17820,17852,17884,17916,17948,17980,18012,18044,18076,18108,18140,18172,18204,18236,18268,18300,18332,18364,18396,18428,18460,18492,18524,18556,18588,18620,18652,18684,18716,18748,18780,18812,18844,18876,18908,18940,18972,19004,19036,19068,19100,19132,19164,19196,19228,19260,19292,19324,19356,19388,19420,19452,19484,19516,19548,19580,19612,19644,19676,19708,19740,19772,19804,19836,19868,19900,19932,19964,19996,20028,20060,20092,20124,20156,20188,20220,20252,20284,20316,20348,20380,20412,20444,20476,20508,20540,20572,20604,20636,20668,20700,20732,20764,20796,20828,20860,20892,20924,20956,20988,21020,21052,21085,21117,21149,21181,21213,21245,21277,21309,21341,21373,21405,21437,21469,21501,21533,21565,21597,21629,21661,21693,21725,21757,21789,21821,21853,21885,21917,21949,21981,22013,22045,22077,22109,22141,22173,22205,22237,22269,22301,22333,22365,22397,22429,22461,22493,22525,22557,22589,22621,22653,22685,22717,22749,22781,22813,22845,22877,22909,22941,22973,23005,23037,23069,23101,23133,23165,23197,23229,23261,23293,23325,23357,23389,23421,23453,23485,23517,23549,23581,23613,23645,23677,23709,23741,23773,23805,23837,23869,23901,23933,23965,23997,24029,24061,24093,24125,24157,24189,24221,24253,24285,24317,24349,24381,24413,24445,24477,24509,24541,24573,24605,24637,24669,24701,24733,24765,24797,24829,24861,24893,24925,24957,24989,25021,25053,25085,25117,25149,25181,25213,25245,25277,25309,25341,25373,25405,25437,25469,25501,25533,25565,25597,25629,25661,25693,25725,25758,25790,25822,25854,25886,25918,25950,25982,26014,26046,26078,26110,26142,26174,26206,26238,26270,26302,26334,26366,26398,26430,26462,26494,26526,26558,26590,26622,26654,26686,26718,26750,26782,26814,26846,26878,26910,26942,26974,27006,27038,27070,27102,27134,27166,27198,27230,27262,27294,27326,27358,27390,27422,27454,27486,27518,27550,27582,27614,27646,27678,27710,27742,27774,27806,27838,27870,27902,27934,27966,27998,28030,28062,28094,28126,28158,28190,28222,28254,28286,28318,28350,28382,28414,28446,28478,28510,28542,28574,28606,28638,28670,28702,28734,28766,28798,28830,28862,28894,28926,28958,28990,29022,29054,29086,29118,29150,29182,29214,29246,29278,29310,29342,29374,29406,29438,29470,29502,29534,29566,29598,29630,29662,29694,29726,29758,29790,29822,29854,29886,29918,29950,29982,30014,30046,30078,30110,30142,30174,30206,30238,30270,30302,30334,30366,30398,30431,30463,30495,30527,30559,30591,30623,30655,30687,30719,30751,30783,30815,30847,30879,30911,30943,30975,31007,31039,31071,31103,31135,31167,31199,31231,31263,31295,31327,31359,31391,31423,31455,31487,31519,31551,31583,31615,31647,31679,31711,31743,31775,31807,31839,31871,31903,31935,31967,31999,32031,32063,32095,32127,32159,32191,32223,32255,32287,32319,32351,32383,32415,32447,32479,32511,32543,32575,32607,32639,32671,32703,32735,32767};
-static const fp_t square_table[] = {0,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767,-32767};
-static const fp_t noise_table[] = {32279,2123,-4068,3497,13751,-24550,-4792,10125,-31525,19298,-3233,16554,9307,29225,-27763,-27089,12887,21261,-29800,-25202,8894,25964,14281,4763,30419,17095,-17138,11207,31842,15582,-8732,18059,-3445,8418,14099,-6589,-31365,4085,-12622,-12168,-19566,23170,3472,24488,14206,7686,-28633,11464,-27359,-28150,19023,17603,-15598,-8818,-9825,-31747,15842,-28989,-12754,-19845,-3380,-25932,1788,14603,-20368,-32711,22032,-4090,-28232,-32169,20153,-2025,-14890,-2458,-2215,19215,-8789,-22326,-21276,13475,12330,26686,32151,-24817,4787,14282,19176,6439,4954,-32586,-3720,12373,25788,-5112,-9981,-17370,-8568,4055,18009,6902,-643,-16413,31899,13676,7200,-32143,5923,28442,27122,25508,-29105,19287,21507,28587,7709,-11077,5535,15392,-12825,22885,27489,16985,-1030,-27285,8699,-29409,27107,30366,3670,-13424,23070,-19397,-20042,-24552,29377,26206,-27716,23895,14690,-1400,-11284,17220,-8778,-32463,-25181,32489,22640,4089,27216,11470,5811,28101,4245,-10563,19893,10766,-21694,29266,-23511,31210,12382,13658,1503,22504,-9463,14221,-16282,19149,-28466,-18670,13670,-4856,19155,22848,20780,24850,3547,-431,-17107,18827,-6148,-8225,28400,-7182,-26024,21654,-5108,27997,25507,25729,-6149,9887,-2932,-27724,-2210,-22942,-12730,-7861,-16479,18806,11821,-11600,-28140,10925,-10958,-104,9449,-9366,16042,-7452,22179,20788,2306,-21418,-18396,12004,10506,26711,16627,-29986,-32276,-2359,15336,26302,-10745,6450,11512,30548,-13566,10829,21896,27093,-4450,8071,-21524,-3584,12295,-19185,10784,10571,-56,-18279,22599,-2301,25529,7997,-13326,-16206,7970,-29608,10985,-1680,-18982,6652,19365,-21047,-15240,1268,31291,-6862,14662,-30884,26023,10030,-12363,-8619,-25495,11653,8898,-30399,29174,-27579,-11002,6250,-7446,-4730,14873,31443,-12757,-5908,20271,21783,25703,-4432,12694,-32370,-22774,-10131,412,-31459,-6720,378,10476,-3185,-13897,7162,-21193,-12316,-26959,-19579,7761,31153,27808,-30226,-4408,27568,31274,-7305,15092,-17865,-25066,22479,-9718,-30048,-16148,14990,18635,25271,-16386,24370,8487,-1903,-25608,-21392,29368,-21345,6223,12018,-27201,27166,-32607,6,14129,-12417,-6991,-11967,-6005,27017,-2291,32352,-13364,-30670,-32173,14736,-8288,-19895,28321,9809,29610,-17782,-11790,-1302,-19410,-25337,-7373,-967,3076,16924,-4420,10667,-30492,5191,31670,10083,-2737,-26573,14713,-6351,23344,5122,-21421,8380,-30460,21396,7425,-17126,29262,-1863,-5466,15300,-13759,20381,-9509,-244,-22360,-1337,23062,-9574,18022,-8242,-8850,12587,18385,20309,-6381,24103,-21187,796,-1536,-5177,4584,-9737,-15752,21282,-10827,-20957,-7865,-7664,13455,-30254,12892,30820,-30065,9976,6581,-25539,-17927,17623,-32227,16640,8044,18847,25586,6584,28423,5385,-18907,-14467,-18886,-10562,25328,-29316,9650,17498,-3820,25663,-27304,-2454,-24347,-14985,25762,-7652,2106,17241,-30796,25053,-19718,8067,-17064,-14140,-10720,-25476,30453,-12718,2784,-16796,-15218,4310,552,-21444,20663,-31778,23402,7913,23384,8285,14448,2744,-14842,10354,12089,-15069,-16566,-4350,28993,-22774,-9541,-4779,5733,11148,19739,27006,-13356,-31569,3530,-17873,12965,10533,-22784,-11457,6514,-14070,22640,-23143,31837,-28174,12133,22688,-30865,12975,-9944,-10963,-5920,27062,-5216,24190,27167,-20522,-20831,15552,21608,432,9099,11350,4489,1759,24996,6251,-13424,28349,-4614,-7895,-17008,17842,31544,1198,12584,18109,31804,32721,17889,20915,10418,23551,15622,20358,13867,12563,4237,-28422,-1384,21518,28434,-19110,21665,16011,-17339,-26262,-32519,-29571,-18521,-12071,-23912,-1236,12559,-15349,-23402,11634,-29337,-7555,28662,21424,-11854,10738,2358,-29300,-29116,9324,-20667,-17711,-31825,-27211,29146,-1882,22207,29373,1952,23303,-24376,20771,2228,-1772,-13174,17070,16423,32107,-881,2301,27080,-4244,19691,-26285,14219,3898,-5992,-6123,30297,2930,-424,-29474,-1273,-13831,7684,13924,-21259,14623,29391,25262,-28185,-4879,-30032,-4451,27341,-23231,-30711,-19185,27258,24113,904,-26192,14956,-12828,-24334,3208,30673,5449,17769,28655,18381,29433,17476,7639,-7210,20807,-4100,23802,-5911,30772,-16035,-10107,-12378,4588,-16571,30361,25379,-29692,-22304,7169,-10756,17577,5935,1201,24704,-20199,-14445,-14978,19426,26990,165,23832,27832,-25533,16311,-24778,13606,10775,19555,20385,-14044,-10881,-21560,1213,1640,28999,8840,31627,13480,27619,11025,13615,18020,-30066,23359,1594,-11200,-5898,-25613,-21818,-11381,20197,4434,-20582,469,-14004,9884,-18789,-3751,-4105,-15044,-24265,-13883,27982,1554,32628,9457,16276,30665,-22861,-14783,-30883,-876,11392,-22833,5831,12076,16162,30938,3881,28125,-4477,23049,-13298,-29583,18083,25248,-21981,-15472,21890,17675,-9215,-24940,31874,-15445,30828,18185,16035,7032,1117,11728,17068,-2886,-30684,5164,30029,25777,-7596,30998,30358,21582,32424,21838,-20834,21000,-2388,32735,-17032,-20878,19902,-18944,-3101,9998,9998,-11715,3128,-27953,14248,-27853,23650,5570,579,-6126,8945,-20436,-32422,12826,10249,-2915,-6660,-4008,31185,-12712,-6946,22257,7232,-25875,24864,24244,-18530,31404,-25773,-13508,-27645,-9506,-29503,-12669,29122,29607,-29212,20911,-12608,26709,26405,-30745,26104,24741,-9963,29206,817,29390,8507,-9634,-16053,922,12895,-18391,-5564,28723,24464,4487,-18659,-5669,157,19478,14930,-13910,-17963,8891,23342,12903,-21491,3759,5607,29321,24687,-31591,-16777,-16871,4046,-8483,4193,-15862,-29517,4946,353,11710,7499,13984,11782,-10196,24534,-10214,4097,-13128,-20444,-19690,8948,25913,28035,23487,15995,-16909,-30525,-32020,963,-23556,26860,-16862,20672,32208,1498,12662,17127,-19359,-30687,-31195,-30020,-9574,-6142,4608,-27553,25767,-27621,14235,-23120,-353,32388,-32219,26226,19805,-22092,-23993,-18085,-15731,-27267,2442,13785,-32225,-17013,-4049,-13764,22657,3210,27000,-8399,16823,-29923,-24993,-24553,25071,-27993,-26785,5509,-30811,-29968,-1882,-23693,-27353,-17954,27923,-23425,5782,9601,14943,15330,12702,1753,-8275,21983,30046,10872,-30627,15066,2895,23082,965,-26635,-19088,-20157,11476,-13190,17066,27343,-14031,-22922,-22322,27186,25117,-8585,-21529,-21722,26767,-14046,-4053,-2045,-32019,-23728,27865,23897,6518,24514,22966,-32636,14682,16145,20984,18586,-17335,29736,2023,24057,-18904,-5740,-30777,-23448,23619,3684,-25976,-7463,-16369,6110,13914,-19667,-4795,-27919,18764,-4135,25781,3293,24624,23951,1888,-22249,-3687,6539,17683,23336,-4731,-4048,-25362,10342,30181,4197,-24959,-12249,24063,32175,-22438,28071,-29364,-17529,-3718,31845,-12121,6165,-32511,18352,18722,9047,3598,-11553,-3951,-1212,-16597,-6184,23675,26313,-30385,17771,-9273,-18374,-8629,-5119,13042,-10424,28503,-4346,16335,-32263,11845,20408,481,-1717,4790,-383,30585,13706,13857,-16217,-10451,27302,-2982,-6385,3036,10407,11213,-8747,12901,23784,16208,16346,32337,9163,-9060,21426,-1847,-18838,-19554,-23288,-12052,32589,-30331,25540,-15771,-11393,-18910,4457,-22435,-23957,29326,31436,-8018,-3893,-11422,19041,-23902,-763,-678,-23508,23063,26013,27682,31742,-15900,25254,17205,-25680,4321,-16458,28818,-22658,-25996,-11993,-20138,-11634,-6163,8323,-16542,-25030,-9499,-16930,-14969,11616,802,5498,-20869,16335,-11659,-29138,30905,-8253,2262,31128,-12710,3026,-1588,28883,28324,-8401,-31632,-5357,31825,-8935,13673,12651,-10746,19837,19296,-5823,-15180,-9263,-4082,30505,-13608,-15034,-22370,-8121,-30600,-16739,23275,-10288,1956,14113,22901,28263,-10099,29454,-30389,-29338,-13725,-28701,-3400,-7881,-30478,15839,-23628,-314,12273,-2021,31546,-27277,-4419,-17078,13938,15810,-20364,-32070,-14795,23168,23472,-7361,-14083,17863,31807,12534,17683,20494,-8623,25147,-28753,23118,-12298,-29912,5740,27403,-16729,21845,24614,30473,-8620,17935,-20264,11034,3127,7091,-29728,1226,3961,-21387,-1481,-23765,-22050,-654,939,6755,-1967,-4855,21291,12314,22994,-19533,-7046,-10181,994,-3363,7178,2043,-5395,18766,-12745,-13091,15210,-14410,14562,-26606,8305,-1844,17831,16580,17799,-23610,-2178,-19643,14332,3034,-17852,8778,-10913,29668,22733,11383,-24533,-26000,-29492,-32240,-20500,18885,-20086,-6548,12057,13638,-24351,-14382,-4908,-23578,-8390,-1198,-28717,7394,-19015,-2084,-30002,23118,18136,-2117,-19692,24801,14935,6836,-2614,4875,5857,-23944,12332,26182,-6027,-898,19638,-19444,-4704,-29552,7914,24783,-3361,9615,-32600,-26912,-12633,-21351,24815,-16844,-31932,-18269,-984,-18580,7669,-27149,-14130,21033,-28438,29852,-973,24769,5353,-15321,16530,-8257,30092,-16619,2392,-3973,20379,21641,13949,9772,-6483,13197,4403,-23822,6447,-11052,29718,-3013,19182,-67,13488,-23866,29217,-30973,7888,-27802,27378,-2047,26254,-22789,7588,1004,4461,-31763,-17019,-15434,-28973,22922,15864,28059,-27587,-30881,7316,-4168,19600,-18868,-10985,20559,-31822,11511,-3715,-3829,-3937,26932,-652,-25584,10669,552,27743,15821,31699,-23361,2978,-17479,-24266,-29076,-16094,25179,-388,6819,-19962,19756,-17667,15025,-15097,7394,-32018,4842,6381,-31997,25860,-12799,760,25500,-17121,7737,13035,-26903,30958,-4160,6253,15337,-21531,-22215,11602,1402,19768,-30194,-27457,-1387,-24021,32113,-2773,5283,8885,-32037,8346,-20001,-11882,-22860,-19766,-28595,-25808,27589,20009,14161,-15647,-31601,-32644,-7858,19451,3983,-6819,3028,-18873,16083,16688,26548,14999,22401,-8636,-4052,28260,-15063,-30588,-3953,2255,52,-2454,26068,21269,-6898,17495,-7112,613,24430,19798,-924,2705,14477,8604,4976,7479,-18267,9534,-20890,6000,-1287,-12351,11861,-18446,24160,-22371,-30488,21911,-6179,-2876,17451,15498,33,22907,-26569,-9216,18607,-25637,16096,-22294,-3649,-30132,28325,9083,-18417,-6818,14333,-10596,-4627,-25157,-8504,-7700,-19023,18209,-6641,25597,28330,-24421,-13711,7025,-11753,2239,20769,-30052,15934,30383,-12032,-22247,-17411,31226,27614,16560,13209,27301,-3130,-1111,26946,-22131,-29926,-12462,28070,-32240,-6772,13527,-17515,-22830,-31705,1950,-8495,-6025,-28432,-11946,-9196,16198,10564,30242,755,462,30143,-7025,-2244,7350,11846,-67,624,-20552,2435,26409,-10906,-16398,-18616,-11003,6043,13093,-4757,-5575,8731,25922,-7293,17168,6504,-32355,25245,-4373,-18085,18733,18964,2433,22733,-18082,5831,-17950,-31227,24708,3398,-15874,-27959,8808,10426,-2760,19037,-12662,28136,-22280,11745,27424,21971,-5040,-25755,11304,-20393,-9190,12561,-26383,13746,-11998,5096,29542,8500,-9491,-5893,-27979,-21330,3961,-1705,-31021,20178,30453,31501,-7553,-18273,29822,-11841,11317,-12248,1989,-24320,30212,-11092,-21345,-15338,14463,-1431,19363,16466,-6932,7198,26809,-28405,23291,28239,24637,-7643,28395,30689,29848,27359,27214,6898,-10993,1355,-27216,-20204,14461,-25746,31332,2032,12533,-3980,6409,-5617,-16661,-22523,-3722,10316,-13779,-488,-1725,-11607,-1203,-4505,10737,-101,2933,11983,22760,-18394,976,-27387,12909,2280,30550,-1046,13299,-9697,-12595,16991,19872,-21619,-3859,-32703,-16542,12913,17830,30176,-23146,20320,-6199,4925,7813,-11236,22091,22853,25552,9058,-19851,-25931,12887,-13951,-13743,16178,-25963,32068,252,-6716,-23393,-18441,-8980,-9974,-25644,32701,-19264,-30795,-11762,26063,21108,-18465,30430,-18699,-4873,-19180,-240,28661,-19478,-25898,7060,-2213,19761,31205,-1192,11197,31487,-18055,-2246,-5713,15874,-5405,3646,-14179,13980,-23537,31172,-1854,9250,18648,6113,10059,7804,-20000,-24743,-3246,7007,-23797,-13954,-26568,5081,-31259,15930,10579,17379,16167,32658,9030,-9601,-16097,20819,-16830,-13532,-14011,14139,9449,30609,28190,28340,25051,-12628,-22029,-2521,-16730,-509,29598,6392,-30577,-15788,8669,-10919,-32386,-8256,-7117,-13799,-19490,5833,-8882,-20763,25518,-30761,-15229,-24612,-4380,13767,15947,-27667,-21844,29857,-2459,644,-8270,-14805,19243,14169,-19084,31180,30740,19345,6500,9684,19109,-24843,18615,4478,1170,-19364,-6322,-24216,31820,-22276,-18929,-8094,15814,-8244,-16157,-6851,5344,30212,14887,-7077,-26738,15750,19934,8067,5347,-10724,-21475,20074,-32413,-23500,-31427,-18891,-5635,-9654,-6852,-20297,30612,-2559,-5882,-19728,-28312,-10724,-29272,-17506,-22398,29852,-20873,-24002,21608,4794,-27468,3593,6208,-1367,-22040,-6537,-9165,16543,26049,23092,1120,16459,4322,-6383,12101,-11963,8338,18986,16945,9143,16869,-12985,-15395,17647,11562,174,-27140,-10952,-6849,7308,26444,-9859,29050,29580,-3693,5907,11311,9816,17245,-23930,-10168,6300,-29753,5590,15361,-3327,-30782,-5977,31070,-2816,28657,16982,-19816,10502,-11190,-4505,-20932,-9974,10778,1998,15567,-17682,22828,27574,-7000,-13772,-18636,-21776,9317,-18175,-7128,9915,-2304,-25281,31199,-31672,17083,21200,-685,22146,802,16955,2831,31313,-18434,-32379,-14394,27480,11566,28905,3334,-12831,31328,31397,14310,-7624,29156,-27342,16797,-11451,15926,-31787,6333,-18445,-12163,17214,27548,146,-1077,31186,3317,-7631,-28859,-23153,-12187,32649,20139,18049,29597,15913,27506,-20172,27868,26714,21634,25446,-25888,10066,32315,-16153,9388,-4592,25554,-28582,12635,32290,24716,-24227,-12424,30647,-6439,-20658,-9895,-21983,1653,8412,5349,-10658,7790,16435,11281,23813,-20122,4169,31404,24710,10833,-28631,-28934,-5728,3831,25757,-13424,-7135,-16259,1060,-8333,-1737,31627,23079,19308,19345,9886,13990,-3905,-22814,-6135,-28225,-12121,13327,13393,-26319,-1450,30700,-4173,32217,23410,13125,-23906,-21852,-31788,-14440,7219,10775,-13150,3244,416,-21595,-10281,12681,30500,-13797,27163,-22190,7896,14458,19824,-6981,15916,-23734,-8844,18888,1299,18605,-32000,18683,-6864,22700,20605,-27779,-8949,-19076,-1609,-24660,20634,-558,8742,-29213,-6428,-26405,-15113,-30948,-19454,-16837,1924,-6249,-15771,-25927,24430,4135,-23400,26153,-19591,-28824,-16756,29290,-28929,16319,13085,26700,18091,15214,-26621,22593,-23468,29963,-31148,7270,-10942,21777,18102,-29111,6712,699,17708,19211,1931,8559,-30076,4307,30373,32350,31527,-17902,7365,14804,936,-18635,2823,9842,-11421,14005,-28882,-9302,5902,6032,-47,-17190,18388,27430,-2465,21544,-4357,-28299,-27649,-12043,-28681,-26735,17393,-30702,1835,-5712,-14683,7066,30947,5612,-32639,-31186,17831,4023,-21709,28333,15418,-14941,23303,-1089,-20327,-21042,22710,-14113,-10800,7534,441,9485,-24596,20377,7345,5015,29137,-7638,-29985,3674,-7434,24283,-26011,12998,-28804,-8303,-14918,-30357,-18388,-32594,29015,-2892,20732,6153,-19912,29141,29116,4293,15069,1889,25497,-3446,-15747,25709,-16212,-21385,-28570,29202,10606,17108,13121,13807,25824,27870,20596,29254,-30368,1357,-25950,24921,-11741,-21517,14990,-15782,-9589,26665,-22996,-3343,-990,18326,-13074,2307,6103,28147,-20080,16834,-6149,-31645,653,-30515,-15546,-31961,-17170,32765,9639,6743,-3864,30902,-28679,-7848,-6152,-23217,-19748,-2412,9043,5225,-28379,-8951,29166,-18297,17969,11441,-27510,-16867,-3739,32603,-12415,-412,24402,26707,-7349,-12573,-11889,-25521,-32478,-16536,26393,-32446,-24259,-104,-30131,4873,10164,-9774,-801,-14848,-21694,32709,-16137,-6501,27686,24609,28545,14262,-28160,-32564,-22711,4919,-12254,13665,29272,15987,-22910,-19373,-14010,-15523,24092,-19956,-31481,-25587,27535,1555,-6918,32639,-16677,-13922,1014,-8305,-234,-28031,-28568,11548,20872,32312,1817,-22150,9456,25087,23459,10873,-22275,-7825,11256,12156,-10588,-5117,-10946,4997,4830,24046,-8834,27936,2421,-28499,10423,-8263,9129,-31399,-29565,24743,6899,18954,9976,2659,5857,29742,-11842,-32137,2399,-4746,-29942,8729,-7557,-8703,15776,-29593,21903,17364,17252,-6284,-13552,25257,5343,27850,9972,-14745,-7601,29241,3464,15831,24589,-721,-3892,10152,12702,-11338,-23682,10135,19904,19931,31479,13714,-19653,-30995,-25701,-634,-26792,-30642,-32647,12758,-14186,-22181,-20045,26104,10541,-26271,-25350,7059,15295,-23786,-3426,-24959,-26521,-6261,-16206,18405,7690,-1850,-8188,7395,30757,-20931,-9729,4454,29532,-16702,-16927,3642,-4527,3495,-15014,-19595,5128,-2581,-26290,7835,20490,-30148,-5295,-12767,4129,15525,23225,-31403,20380,2951,-25297,-5191,-6880,2381,29728,2516,-18759,9858,17813,21493,-28296,1423,-30466,-3411,24715,1895,30729,-25171,-30302,-23251,-11237,26616,9005,-20245,-22024,-10652,-31373,11089,-8807,-12476,-762,-10776,-9520,-2224,31206,23054,10615,-30235,-11676,-21637,20855,-16065,17047,-22396,14079,21196,31093,5036,20994,22102,-10258,-13180,7833,-3838,-17744,27603,13451,32638,24308,-5873,10138,-1954,-19822,-28406,-754,9598,12023,-26359,-14493,-8704,20768,-32679,-12673,-2510,-3486,24656,815,1985,-21670,3166,-2387,-4189,25342,-15793,18988,19554,-12078,22474,22388,16531,-29110,-15710,19104,-180,25788,13305,-28071,-13756,-12365,-3412,4084,29226,-11893,15130,-27385,15505,-12492,-18707,7781,19049,-20586,-20305,-16284,2036,27173,-16081,-14142,2969,28995,-13331,-8981,3540,-14818,20507,4124,11862,-12290,28022,-12414,-25778,16058,-3418,12191,-16918,-3763,-5527,-470,-5571,-20981,10062,-1715,8044,21331,30593,-30011,-29410,-25736,31566,-8672,-16115,-10422,6729,-27487,-9732,-5031,-16303,-14967,20199,-14859,-5228,29933,113,-12467,31691,-9736,4428,10409,30624,-24968,5392,23490,-7886,-32605,-9902,-9586,28964,-11298,-27326,24813,11190,7541,-26406,26775,-21485,-20282,31699,-15700,-26114,2491,2086,185,28939,-5634,-25605,-14974,759,31424,-25714,-26189,-1595,-15840,-10958,5047,2034,6324,-5038,-2691,11978,5679,-5479,4052,-5460,17134,-10720,-28425,-19325,28315,-2448,1980,19697,4819,-6266,2566,-15238,23789,-29657,4740,9659,12725,9082,7788,6893,-23460,-20750,-5100,-28241,-2895,-3164,25575,5888,20734,-4734,-19399,9359,3506,-804,-26959,-19882,-23544,16072,-22684,-26904,477,-4102,-13091,14578,16851,-31225,-11234,-13595,32415,31066,-32288,23515,5637,-9506,-8943,-15782,31251,-31388,9360,-17519,-4409,-22018,-24668,-2085,12052,15294,-23585,-468,9715,-12640,-30992,-24038,-27275,11551,-24778,-11111,7045,23240,19101,5745,23852,30733,-16527,6399,-21911,22326,-23478,-22097,17999,-2223,-28493,-28737,-10268,3332,-17668,-19963,2402,-27216,-18619,-22075,-30966,-25763,-17594,726,6180,-26735,4839,-26007,-13911,-20560,28290,14844,-20362,15453,19055,-1813,2670,1426,-5207,-1084,11430,-19127,30228,21997,-13877,-5456,-3237,-882,29240,14838,-8140,-30685,-17799,-9341,5708,-29533,7225,-30671,-10022,-4860,-9701,3589,24523,-12307,-28264,3795,-21018,6884,13924,20710,23849,21962,-24698,-15438,30575,14617,18147,17070,11412,8776,22544,-11339,-30570,16522,-22871,25361,-5561,-32424,1908,-10639,2483,25713,-20371,15545,4656,28345,-28873,-11437,13543,6686,6119,-8587,15173,20052,-284,30913,-21279,-24292,-14192,-20000,-704,28205,16568,6677,-7868,-6213,27817,-17115,-16768,-12908,29285,-23697,8742,-10917,20285,30818,-28055,19532,24470,31412,-16480,-6836,-17591,10459,-19169,27467,18105,-13539,32554,9332,-22618,-12014,-23597,-17708,3871,8960,10860,-11604,9710,-1779,-1138,6672,-9604,31939,-29715,20999,5818,11701,18942,14017,6323,9467,-30565,4060,-31710,-13657,25054,1596,-7465,-21218,-2714,-22344,31021,-31362,817,20924,6317,-17480,-8634,-11360,9275,6272,4643,15388,-2607,-558,27437,-32552,22090,-16843,-17272,-22633,-9141,28712,15492,18705,18773,-10843,-27673,-3631,-22141,17487,-6188,8180,-30684,-23428,3976,11162,-10035,-23389,-20216,-28911,16655,25270,-26658,11319,-16760,-14247,-1076,24186,-9839,19285,31605,-7970,4854,29045,-24800,-25317,-8969,-31342,-132,3354,8024,-1983,32071,20894,-26450,-13411,2974,-16180,-17168,-28567,-12181,2185,12493,-22471,-23908,9947,27371,-15203,-12384,-8439,-9486,2005,28121,8566,25894,-26040,-8496,-14994,-12799,-9221,-22635,-25132,-20149,13006,24618,-22076,7736,12328,32576,-5275,12382,19808,-11855,3119,9491,-8910,-16792,-11870,-11634,-7935,29377,-24560,-32629,-29833,22367,12825,-11025,-22192,-29487,-9119,-32009,-31613,26897,17392,-3863,24505,2680,-3538,26395,-28693,-11039,-18199,-8377,-28291,27618,11707,22575,-9796,-2677,5689,-15532,-11302,28704,-14304,-3710,-17012,8971,7206,16932,16049,-14865,14394,3293,12803,4764,-3035,24090,11865,-27745,-11644,-27508,-23709,5813,27509,-1911,2045,24941,31457,-32190,-20039,-12404,6950,30963,-17103,-16847,-11035,27699,3121,-22017,-6873,16332,6618,-1212,-29457,-29960,14201,-6825,16219,3575,-30435,-10889,19119,-18311,-7852,-9394,-27221,24306,15432,-6819,13138,5414,-804,17681,31883,-21275,14330,-25418,15787,-15760,12144,6739,-5131,18071,-10880,3181,-14023,-7161,19262,15307,27055,-12714,11554,-13706,23878,-19804,22205,22007,9780,19442,9815,-6406,19702,31692,4747,-9858,-27763,-27894,-8737,28171,1681,-17309,16678,-2384,22919,5169,-12319,-19987,23425,-1833,-4335,23056,-14858,-29759,-16159,-11093,-30469,-11363,5561,-31599,7618,667,-29531,26465,-7532,-5824,22402,-11290,26489,22555,-10374,-10981,23029,-4610,26926,4114,-18752,11962,29649,12315,-17443,7975,5488,670,-17393,25488,16749,-26913,23221,26126,5431,20597,25564,-29830,-2374,99,-3909,13069,20174,20505,-5038,-16855,11042,4985,19608,-16944,-7941,9187,-5161,28882,-561,-25106,-12674,-22198,-5676,-29711,20788,29153,-28074,6031,-26539,29555,-18353,27689,21545,6647,-20279,-22766,-15291,-12082,6002,-3570,-3262,-11295,29162,-4536,26158,-22050,-32727,-29918,-4107,12720,11596,30772,-30141,9030,2837,30640,2173,-14137,-31781,29264,-3022,10883,12233,-5849,-28945,-7544,11901,-1776,12404,-8511,28867,-12644,-22643,28228,-24417,8594,-14679,-8213,-19522,-16278,22566,7966,-27472,-20709,-24182,-20743,-30277,-17091,-19905,20695,-26790,-15885,-6717,30350,18643,-9330,-17273,28037,-26693,-496,21725,-2281,-31794,10231,5502,2656,-13753,10449,8958,29060,24171,30964,-1488,4341,-17358,-16104,4512,8977,13823,29074,-13940,14181,23514,22768,24732,27321,29785,-1471,23118,30744,16398,28209,-7167,-20449,-11525,21537,13257,-9990,-20591,30772,30678,28215,23670,4160,2626,-26670,19971,-13208,-10685,17807,-26493,14935,-23657,-12379,-14012,-2777,26857,-17352,-27923,-1344,20252,23408,-1222,-13121,-26484,8006,-15979,-26238,29601,-18433,-14180,15081,30241,-10195,-475,3924,-851,1597,31634,-14149,14994,-21981,19662,-27340,13400,-9255,1656,32340,27537,-31241,11540,-18912,11572,9795,-9055,299,24180,-28624,-2571,2495,26875,-21572,-17624,-1435,12212,-7050,11296,-11558,9057,-30076,3124,-25483,-32159,24731,14673,30946,18179,8589,27388,26905,28098,22361,-24423,1342,7780,16486,-28548,-16263,12483,-14936,25959,14615,-30006,-19385,-8411,7566,19118,9421,6048,9164,5849,-19825,-32690,11268,23595,-1096,-2017,16899,-4523,1997,14833,-6880,14782,-22764,22833,13394,-31202,-7965,-20775,12690,28162,17281,15949,21472,-5857,19328,11297,-17251,1941,-11566,14832,-4775,-10296,-10974,-5150,-2462,-29935,-20271,-12038,-367,-21999,13724,25520,-20356,-7414,15603,-29300,21943,6147,-2411,15089,6123,13079,-17591,-24542,8658,-8535,27070,-1306,18543,-3982,26698,-5924,12153,26793,-20492,-3224,23400,12817,-13775,2467,11869,24899,-10975,13162,6254,-9242,-12233,-22493,23306,-16292,-16918,-1745,-10788,6276,30872,1241,-2256,-2141,7322,26941,24503,485,-29408,13941,16001,22335,7134,556,-31391,31583,8017,-14272,9906,-11403,-3787,-31776,19747,27139,19440,-22604,16966,22936,22250,-28290,-14201,22325,-5168,-19813,-8624,22882,23148,28716,-28470,-12370,11168,-16907,14783,-21939,-3438,20204,-4900,-13440,13135,-25577,-19734,-11669,-13303,1205,-12808,18438,-5107,26524,20030,-20549,31950,3193,23004,25287,-26081,22350,2977,-17730,32146,7884,-29285,-22864,-10660,-28775,-26828,2707,-28472,30515,-2508,26947,4083,-5468,-29636,-8544,-11473,-8506,24179,-6066,-12290,27267,-21745,-5195,-5417,30473,24573,16444,-19777,8853,-14729,24890,-12896,-10911,19116,-32039,16207,14470,-12028,-24060,-15445,-16917,5412,480,11539,-10288,-23579,-28366,-22526,-14540,-11411,24554,-23370,-13868,-6068,10357,-11533,29887,-14444,16796,17585,-1308,-16732,32487,15284,10484,-20529,21644,747,-19995,-538,-23156,-27787,4291,-14664,14189,14757,-28275,4309,26607,-30866,20936,-7958,29169,-21637,943,18985,25401,30137,19955,23150,29044,-16835,-17823,11941,23603,-28851,-25040,-7748,-29389,-18956,32288,-32456,-10096,-28786,14334,11233,5242,-26243,8925,-3169,-13425,14770,23558,-2062,-19296,3493,13463,-17160,-27708,26986,-1895,-13165,-8311,16837,27888,-664,30135,-3257,-31358,5418,-12609,-22890,-18290,-21930,-32494,-19634,30876,19209,-28485,23012,-31597,-21447,2511,863,24519,-22812,-5654,-32593,-21161,-28175,-486,-16176,5527,-13704,-5358,26402,21119,13273,-11361,-22239,-28585,7898,-28439,-9866,-11539,14335,29676,20748,13713,-31609,-3625,11644,-12045,-18025,29661,-25800,11756,-17661,4797,2712,4047,3406,17136,-14383,15935,27134,4061,-13125,-13261,-23938,2591,11614,-4004,31952,18118,-30933,-24590,5668,-1931,-9020,-19354,5212,29804,18788,18361,-22509,-5344,22731,-21540,-26363,-24276,-20765,-29081,-7204,-706,30380,9231,314,26179,-26141,27628,15603,-12547,-26119,-3519,18632,9037,-16430,-22654,-21203,-16002,11334,-11076,-17382,10517,23334,-28240,-27718,1552,-27231,343,17425,-31455,7930,25049,-10119,-22963,4738,14466,-17829,-276,21576,-31316,8939,31690,-16673,27723,-22376,3940,9682,20693,20438,-12785,14789,4352,-5052,11464,-4411,18582,-14208,-27450,-22003,-19663,6816,-7798,17914,-4442,16248,-4662,-634,-7681,27578,-7723,-19916,-25191,15079,237,-2727,23601,-12102,23898,21862,-27045,32709,-21122,-20625,-13915,16915,-7837,13050,-1237,594,4324,11054,-29854,3153,-21545,-31186,-19137,4563,29971,21685,24252,-19705,23708,419,21805,-28565,5034,6176,11161,4007,31289,27446,-6850,-25009,-24517,21504,-18910,-3585,-14658,-16390,-20046,26051,-18933,-29201,-20493,20914,6723,14298,29530,28143,-9882,-17174,-10511,-8362,-10043,23829,-13393,10999,18811,2251,7360,-6072,-25667,27044,-490,31161,-4167,-13112,18855,30213,-23288,-28287,-26174,-21388,-27691,-305,-20688,-8609,-11994,7517,17683,-12035,31018,-16463,2826,-25054,2375,17955,-15190,22272,30336,-26120,-5226,-21030,-30870,-17329,-5452,-27102,7085,-27716,-7759,4720,13101,18091,14390,-8797,-7875,-16215,-22886,-11081,-14310,-3926,-24778,-25542,11660,864,-11409,16441,-4297,-571,-21892,13626,-3641,25063,4110,7223,25609,5271,27071,-12026,-25687,25297,-22607,6041,-9430,-10861,-20146,7119,-1778,-12957,-16859,-14114,22077,-1683,21311,-17833,-32131,20434,12918,2115,-20102,32582,-15592,6500,27570,28354,-12413,3692,-8231,26270,21180,-16474,3337,-26203,17887,-32352,-11906,28623,-29523,-17594,-15346,-5367,510,-11391,-8896,32468,-32583,28143,-4464,28190};
-static const q8_t increment_table[] = {214,227,240,254,270,286,303,321,340,360,381,404,428,454,481,509,540,572,606,642,680,720,763,809,857,908,962,1019,1080,1144,1212,1284,1360,1441,1527,1618,1714,1816,1924,2039,2160,2288,2424,2568,2721,2883,3055,3236,3429,3633,3849,4078,4320,4577,4849,5137,5443,5767,6110,6473,6858,7266,7698,8156,8640,9154,9699,10275,10886,11534,12220,12946,13716,14532,15396,16312,17281,18309,19398,20551,21773,23068,24440,25893,27433,29064,30792,32624,34563,36619,38796,41103,43547,46137,48880,51787,54866,58129,61585,65248,69127,73238,77593,82207,87095,92274,97761,103574,109733,116258,123171,130496,138255,146476,155186,164414,174191,184549,195523,207149,219467,232517,246343,260992,276511,292953,310373,328829};
+#define TABLE_LENGTH 512
+#define TABLE_LENGTH_BITS 9
+#define SIN_QUARTER_LENGTH (TABLE_LENGTH / 4)
+extern fp_t sin_quarter_table[SIN_QUARTER_LENGTH + 1];
+#define PITCH_SEMITONE_SHIFT 11
+#define PITCH_STEP_BITS 6
+extern const uint32_t pitch_semitone_table[12];
+extern const uint32_t pitch_fraction_table[(1 << PITCH_STEP_BITS) + 1];
 #endif